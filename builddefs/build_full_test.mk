@@ -32,6 +32,12 @@ $(TEST_OUTPUT)_SRC := \
 	tests/test_common/test_logger.cpp \
 	$(patsubst $(ROOTDIR)/%,%,$(wildcard $(TEST_PATH)/*.cpp))
 
+ifneq ($(wildcard $(TEST_PATH)/bench.mk),)
+$(TEST_OUTPUT)_SRC += tests/test_common/bench_fixture.cpp
+# Count heap allocations made by the firmware while a trace is replayed
+LDFLAGS += -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc
+endif
+
 $(TEST_OUTPUT)_DEFS := $(OPT_DEFS) "-DKEYMAP_C=\"keymap.c\""
 
 $(TEST_OUTPUT)_CONFIG := $(TEST_PATH)/config.h
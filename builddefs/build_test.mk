@@ -54,7 +54,7 @@ endif
 
 ifneq ($(filter $(FULL_TESTS),$(TEST)),)
 include tests/test_common/build.mk
-include $(TEST_PATH)/test.mk
+include $(wildcard $(TEST_PATH)/test.mk $(TEST_PATH)/bench.mk)
 endif
 
 include $(BUILDDEFS_PATH)/common_features.mk
@@ -64,8 +64,13 @@ include $(TMK_PATH)/protocol.mk
 include $(QUANTUM_PATH)/debounce/tests/rules.mk
 include $(QUANTUM_PATH)/encoder/tests/rules.mk
 include $(QUANTUM_PATH)/os_detection/tests/rules.mk
+include $(QUANTUM_PATH)/painter/tests/rules.mk
 include $(QUANTUM_PATH)/sequencer/tests/rules.mk
+include $(QUANTUM_PATH)/tests/rules.mk
+include $(QUANTUM_PATH)/split_common/tests/rules.mk
 include $(QUANTUM_PATH)/wear_leveling/tests/rules.mk
+include $(DRIVER_PATH)/led/tests/rules.mk
+include $(DRIVER_PATH)/oled/tests/rules.mk
 include $(QUANTUM_PATH)/logging/print.mk
 include $(PLATFORM_PATH)/test/rules.mk
 ifneq ($(filter $(FULL_TESTS),$(TEST)),)
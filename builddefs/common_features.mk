@@ -87,8 +87,6 @@ ifeq ($(strip $(MIDI_ENABLE)), yes)
     SRC += $(QUANTUM_DIR)/midi/midi_device.c
     SRC += $(QUANTUM_DIR)/midi/qmk_midi.c
     SRC += $(QUANTUM_DIR)/midi/sysex_tools.c
-    SRC += $(QUANTUM_DIR)/midi/bytequeue/bytequeue.c
-    SRC += $(QUANTUM_DIR)/midi/bytequeue/interrupt_setting.c
     SRC += $(QUANTUM_DIR)/process_keycode/process_midi.c
 endif
 
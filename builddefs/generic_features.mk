@@ -34,6 +34,7 @@ GENERIC_FEATURES = \
     DYNAMIC_TAPPING_TERM \
     GRAVE_ESC \
     HAPTIC \
+    KEYBOARD_PROFILING \
     KEY_LOCK \
     KEY_OVERRIDE \
     LAYER_LOCK \
@@ -6,7 +6,7 @@
 #include "debug.h"
 #include "timer.h"
 #include "gpio.h"
-#include "ringbuffer.hpp"
+#include "ring_buffer.h"
 #include <string.h>
 #include "spi_master.h"
 #include "wait.h"
@@ -100,11 +100,13 @@ struct queue_item {
 };
 
 // Items that we wish to send
-static RingBuffer<queue_item, 40> send_buf;
+RING_BUFFER_DEFINE(send_queue, queue_item, 39)
+static send_queue_t send_buf;
 // Pending response; while pending, we can't send any more requests.
 // This records the time at which we sent the command for which we
 // are expecting a response.
-static RingBuffer<uint16_t, 2> resp_buf;
+RING_BUFFER_DEFINE(resp_queue, uint16_t, 1)
+static resp_queue_t resp_buf;
 
 static bool process_queue_item(struct queue_item *item, uint16_t timeout);
 
@@ -227,7 +229,7 @@ static bool sdep_recv_pkt(struct sdep_msg *msg, uint16_t timeout) {
 
 static void resp_buf_read_one(bool greedy) {
     uint16_t last_send;
-    if (!resp_buf.peek(last_send)) {
+    if (!resp_queue_peek(&resp_buf, &last_send)) {
         return;
     }
 
@@ -238,20 +240,20 @@ static void resp_buf_read_one(bool greedy) {
         if (sdep_recv_pkt(&msg, SdepTimeout)) {
             if (!msg.more) {
                 // We got it; consume this entry
-                resp_buf.get(last_send);
+                resp_queue_pop(&resp_buf, &last_send);
                 dprintf("recv latency %dms\n", TIMER_DIFF_16(timer_read(), last_send));
             }
 
-            if (greedy && resp_buf.peek(last_send) && gpio_read_pin(BLUEFRUIT_LE_IRQ_PIN)) {
+            if (greedy && resp_queue_peek(&resp_buf, &last_send) && gpio_read_pin(BLUEFRUIT_LE_IRQ_PIN)) {
                 goto again;
             }
         }
 
     } else if (timer_elapsed(last_send) > SdepTimeout * 2) {
-        dprintf("waiting_for_result: timeout, resp_buf size %d\n", (int)resp_buf.size());
+        dprintf("waiting_for_result: timeout, resp_buf size %d\n", (int)resp_queue_count(&resp_buf));
 
         // Timed out: consume this entry
-        resp_buf.get(last_send);
+        resp_queue_pop(&resp_buf, &last_send);
     }
 }
 
@@ -259,17 +261,17 @@ static void send_buf_send_one(uint16_t timeout = SdepTimeout) {
     struct queue_item item;
 
     // Don't send anything more until we get an ACK
-    if (!resp_buf.empty()) {
+    if (!resp_queue_is_empty(&resp_buf)) {
         return;
     }
 
-    if (!send_buf.peek(item)) {
+    if (!send_queue_peek(&send_buf, &item)) {
         return;
     }
     if (process_queue_item(&item, timeout)) {
         // commit that peek
-        send_buf.get(item);
-        dprintf("send_buf_send_one: have %d remaining\n", (int)send_buf.size());
+        send_queue_pop(&send_buf, &item);
+        dprintf("send_buf_send_one: have %d remaining\n", (int)send_queue_count(&send_buf));
     } else {
         dprint("failed to send, will retry\n");
         wait_ms(SdepTimeout);
@@ -279,7 +281,7 @@ static void send_buf_send_one(uint16_t timeout = SdepTimeout) {
 
 static void resp_buf_wait(const char *cmd) {
     bool didPrint = false;
-    while (!resp_buf.empty()) {
+    while (!resp_queue_is_empty(&resp_buf)) {
         if (!didPrint) {
             dprintf("wait on buf for %s\n", cmd);
             didPrint = true;
@@ -404,7 +406,7 @@ static bool at_command(const char *cmd, char *resp, uint16_t resplen, bool verbo
 
     if (resp == NULL) {
         uint16_t now = timer_read();
-        while (!resp_buf.enqueue(now)) {
+        while (!resp_queue_push(&resp_buf, now)) {
             resp_buf_read_one(false);
         }
         uint16_t later = timer_read();
@@ -508,7 +510,7 @@ void bluefruit_le_task(void) {
     resp_buf_read_one(true);
     send_buf_send_one(SdepShortTimeout);
 
-    if (resp_buf.empty() && (state.event_flags & UsingEvents) && gpio_read_pin(BLUEFRUIT_LE_IRQ_PIN)) {
+    if (resp_queue_is_empty(&resp_buf) && (state.event_flags & UsingEvents) && gpio_read_pin(BLUEFRUIT_LE_IRQ_PIN)) {
         // Must be an event update
         if (at_command_P(PSTR("AT+EVENTSTATUS"), resbuf, sizeof(resbuf))) {
             uint32_t mask = strtoul(resbuf, NULL, 16);
@@ -551,7 +553,7 @@ void bluefruit_le_task(void) {
     }
 
 #ifdef SAMPLE_BATTERY
-    if (timer_elapsed(state.last_battery_update) > BatteryUpdateInterval && resp_buf.empty()) {
+    if (timer_elapsed(state.last_battery_update) > BatteryUpdateInterval && resp_queue_is_empty(&resp_buf)) {
         state.last_battery_update = timer_read();
 
         state.vbat = analogReadPin(BATTERY_LEVEL_PIN);
@@ -624,7 +626,7 @@ void bluefruit_le_send_keyboard(report_keyboard_t *report) {
     item.key.keys[4]  = report->keys[4];
     item.key.keys[5]  = report->keys[5];
 
-    while (!send_buf.enqueue(item)) {
+    while (!send_queue_push(&send_buf, item)) {
         send_buf_send_one();
     }
 }
@@ -635,7 +637,7 @@ void bluefruit_le_send_consumer(uint16_t usage) {
     item.queue_type = QTConsumer;
     item.consumer   = usage;
 
-    while (!send_buf.enqueue(item)) {
+    while (!send_queue_push(&send_buf, item)) {
         send_buf_send_one();
     }
 }
@@ -650,7 +652,7 @@ void bluefruit_le_send_mouse(report_mouse_t *report) {
     item.mousemove.pan     = report->h;
     item.mousemove.buttons = report->buttons;
 
-    while (!send_buf.enqueue(item)) {
+    while (!send_queue_push(&send_buf, item)) {
         send_buf_send_one();
     }
 }
@@ -22,3 +22,11 @@
 void eeprom_driver_init(void);
 void eeprom_driver_format(bool erase);
 void eeprom_driver_erase(void);
+
+// Groups the writes in between, so that drivers which can defer writes commit them together
+void eeprom_driver_batch_begin(void);
+void eeprom_driver_batch_end(void);
+// Commits any deferred writes, called before suspend and shutdown
+void eeprom_driver_flush(void);
+// Commits deferred writes once the driver considers them idle, called from keyboard_task()
+void eeprom_driver_task(void);
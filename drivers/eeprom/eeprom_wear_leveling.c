@@ -27,3 +27,21 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
     wear_leveling_write((uint32_t)addr, buf, len);
 }
+
+void eeprom_driver_batch_begin(void) {
+    wear_leveling_batch_begin();
+}
+
+void eeprom_driver_batch_end(void) {
+    wear_leveling_batch_end();
+}
+
+void eeprom_driver_flush(void) {
+    wear_leveling_flush();
+}
+
+#ifdef WEAR_LEVELING_WRITE_BACK_DELAY
+void eeprom_driver_task(void) {
+    wear_leveling_task();
+}
+#endif
@@ -22,6 +22,8 @@
 #include "wait.h"
 
 #define IS31FL3729_PWM_REGISTER_COUNT 143
+#define IS31FL3729_PWM_CHUNK_SIZE 13
+#define IS31FL3729_PWM_CHUNK_MASK(reg) (1 << ((reg) / IS31FL3729_PWM_CHUNK_SIZE))
 #define IS31FL3729_SCALING_REGISTER_COUNT 16
 
 #ifndef IS31FL3729_I2C_TIMEOUT
@@ -80,15 +82,15 @@ const uint8_t i2c_addresses[IS31FL3729_DRIVER_COUNT] = {
 // These buffers match the PWM & scaling registers.
 // Storing them like this is optimal for I2C transfers to the registers.
 typedef struct is31fl3729_driver_t {
-    uint8_t pwm_buffer[IS31FL3729_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t scaling_buffer[IS31FL3729_SCALING_REGISTER_COUNT];
-    bool    scaling_buffer_dirty;
+    uint8_t  pwm_buffer[IS31FL3729_PWM_REGISTER_COUNT];
+    uint16_t pwm_buffer_dirty;
+    uint8_t  scaling_buffer[IS31FL3729_SCALING_REGISTER_COUNT];
+    bool     scaling_buffer_dirty;
 } PACKED is31fl3729_driver_t;
 
 is31fl3729_driver_t driver_buffers[IS31FL3729_DRIVER_COUNT] = {{
     .pwm_buffer           = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_dirty     = 0,
     .scaling_buffer       = {0},
     .scaling_buffer_dirty = false,
 }};
@@ -104,17 +106,31 @@ void is31fl3729_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 }
 
 void is31fl3729_write_pwm_buffer(uint8_t index) {
-    // Transmit PWM registers in 11 transfers of 13 bytes.
+    // Transmit the dirty 13 byte chunks of the PWM registers, merging
+    // adjacent dirty chunks into a single transfer.
+
+    uint16_t dirty = driver_buffers[index].pwm_buffer_dirty;
+    uint8_t  i     = 0;
+
+    while (dirty) {
+        for (; !(dirty & 1); dirty >>= 1) {
+            i += IS31FL3729_PWM_CHUNK_SIZE;
+        }
+
+        uint8_t length = 0;
+        for (; dirty & 1; dirty >>= 1) {
+            length += IS31FL3729_PWM_CHUNK_SIZE;
+        }
 
-    // Iterate over the pwm_buffer contents at 13 byte intervals.
-    for (uint8_t i = 0; i <= IS31FL3729_PWM_REGISTER_COUNT; i += 13) {
 #if IS31FL3729_I2C_PERSISTENCE > 0
         for (uint8_t j = 0; j < IS31FL3729_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, length, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
         }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT);
+        i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, length, IS31FL3729_I2C_TIMEOUT);
 #endif
+
+        i += length;
     }
 }
 
@@ -165,7 +181,7 @@ void is31fl3729_set_value(int index, uint8_t value) {
         }
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        driver_buffers[led.driver].pwm_buffer_dirty |= IS31FL3729_PWM_CHUNK_MASK(led.v);
     }
 }
 
@@ -192,7 +208,7 @@ void is31fl3729_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
         is31fl3729_write_pwm_buffer(index);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        driver_buffers[index].pwm_buffer_dirty = 0;
     }
 }
 
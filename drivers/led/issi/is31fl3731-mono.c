@@ -23,6 +23,8 @@
 #include "wait.h"
 
 #define IS31FL3731_PWM_REGISTER_COUNT 144
+#define IS31FL3731_PWM_CHUNK_SIZE 16
+#define IS31FL3731_PWM_CHUNK_MASK(reg) (1 << ((reg) / IS31FL3731_PWM_CHUNK_SIZE))
 #define IS31FL3731_LED_CONTROL_REGISTER_COUNT 18
 
 #ifndef IS31FL3731_I2C_TIMEOUT
@@ -52,15 +54,15 @@ const uint8_t i2c_addresses[IS31FL3731_DRIVER_COUNT] = {
 // buffers and the transfers in is31fl3731_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
 typedef struct is31fl3731_driver_t {
-    uint8_t pwm_buffer[IS31FL3731_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t led_control_buffer[IS31FL3731_LED_CONTROL_REGISTER_COUNT];
-    bool    led_control_buffer_dirty;
+    uint8_t  pwm_buffer[IS31FL3731_PWM_REGISTER_COUNT];
+    uint16_t pwm_buffer_dirty;
+    uint8_t  led_control_buffer[IS31FL3731_LED_CONTROL_REGISTER_COUNT];
+    bool     led_control_buffer_dirty;
 } PACKED is31fl3731_driver_t;
 
 is31fl3731_driver_t driver_buffers[IS31FL3731_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
+    .pwm_buffer_dirty         = 0,
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 }};
@@ -81,17 +83,31 @@ void is31fl3731_select_page(uint8_t index, uint8_t page) {
 
 void is31fl3731_write_pwm_buffer(uint8_t index) {
     // Assumes page 0 is already selected.
-    // Transmit PWM registers in 9 transfers of 16 bytes.
+    // Transmit the dirty 16 byte chunks of the PWM registers, merging
+    // adjacent dirty chunks into a single transfer.
+
+    uint16_t dirty = driver_buffers[index].pwm_buffer_dirty;
+    uint8_t  i     = 0;
+
+    while (dirty) {
+        for (; !(dirty & 1); dirty >>= 1) {
+            i += IS31FL3731_PWM_CHUNK_SIZE;
+        }
+
+        uint8_t length = 0;
+        for (; dirty & 1; dirty >>= 1) {
+            length += IS31FL3731_PWM_CHUNK_SIZE;
+        }
 
-    // Iterate over the pwm_buffer contents at 16 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3731_PWM_REGISTER_COUNT; i += 16) {
 #if IS31FL3731_I2C_PERSISTENCE > 0
         for (uint8_t j = 0; j < IS31FL3731_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3731_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, length, IS31FL3731_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
         }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3731_I2C_TIMEOUT);
+        i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, length, IS31FL3731_I2C_TIMEOUT);
 #endif
+
+        i += length;
     }
 }
 
@@ -179,7 +195,7 @@ void is31fl3731_set_value(int index, uint8_t value) {
         }
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        driver_buffers[led.driver].pwm_buffer_dirty |= IS31FL3731_PWM_CHUNK_MASK(led.v);
     }
 }
 
@@ -209,7 +225,7 @@ void is31fl3731_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
         is31fl3731_write_pwm_buffer(index);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        driver_buffers[index].pwm_buffer_dirty = 0;
     }
 }
 
@@ -0,0 +1,29 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "i2c_mock.hpp"
+
+extern "C" {
+#include "i2c_master.h"
+}
+
+std::vector<I2CTransfer> i2c_mock_transfers;
+
+void i2c_mock_reset(void) {
+    i2c_mock_transfers.clear();
+}
+
+std::size_t i2c_mock_payload_bytes(void) {
+    std::size_t bytes = 0;
+    for (const I2CTransfer& transfer : i2c_mock_transfers) {
+        bytes += transfer.data.size();
+    }
+    return bytes;
+}
+
+extern "C" void i2c_init(void) {}
+
+extern "C" i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_mock_transfers.push_back({devaddr, regaddr, std::vector<uint8_t>(data, data + length)});
+    return I2C_STATUS_SUCCESS;
+}
@@ -0,0 +1,22 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct I2CTransfer {
+    uint8_t              address;
+    uint8_t              reg;
+    std::vector<uint8_t> data;
+};
+
+// Every i2c_write_register() call made since the last reset, in order
+extern std::vector<I2CTransfer> i2c_mock_transfers;
+
+void i2c_mock_reset(void);
+
+// Payload bytes written by the logged transfers, excluding the register address
+std::size_t i2c_mock_payload_bytes(void);
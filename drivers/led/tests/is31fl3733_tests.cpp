@@ -0,0 +1,135 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include "gtest/gtest.h"
+#include "i2c_mock.hpp"
+
+extern "C" {
+#include "is31fl3733.h"
+}
+
+// Five RGB LEDs per SWx row, so each LED lies within a single 16 byte chunk of the PWM page
+#define LED(k) \
+    { 0, (k) / 5 * 16 + (k) % 5 * 3, (k) / 5 * 16 + (k) % 5 * 3 + 1, (k) / 5 * 16 + (k) % 5 * 3 + 2 }
+#define LED_ROW(row) LED(row * 5), LED(row * 5 + 1), LED(row * 5 + 2), LED(row * 5 + 3), LED(row * 5 + 4)
+
+const is31fl3733_led_t PROGMEM g_is31fl3733_leds[IS31FL3733_LED_COUNT] = {
+    LED_ROW(0), LED_ROW(1), LED_ROW(2), LED_ROW(3), LED_ROW(4), LED_ROW(5), LED_ROW(6), LED_ROW(7), LED_ROW(8), LED_ROW(9), LED_ROW(10), LED_ROW(11),
+};
+
+class IS31FL3733 : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        is31fl3733_init_drivers();
+        is31fl3733_set_color_all(0, 0, 0);
+        is31fl3733_flush();
+        i2c_mock_reset();
+    }
+
+    // The transfers to the PWM page, excluding the page selection itself
+    std::vector<I2CTransfer> pwm_writes() {
+        std::vector<I2CTransfer> writes;
+        uint8_t                  page = 0xFF;
+
+        for (const I2CTransfer& transfer : i2c_mock_transfers) {
+            if (transfer.reg == IS31FL3733_REG_COMMAND) {
+                page = transfer.data[0];
+            } else if (transfer.reg != IS31FL3733_REG_COMMAND_WRITE_LOCK && page == IS31FL3733_COMMAND_PWM) {
+                writes.push_back(transfer);
+            }
+        }
+        return writes;
+    }
+};
+
+TEST_F(IS31FL3733, FlushWithoutChangesSendsNothing) {
+    is31fl3733_flush();
+    EXPECT_TRUE(i2c_mock_transfers.empty());
+
+    is31fl3733_set_color(7, 0, 0, 0);
+    is31fl3733_flush();
+    EXPECT_TRUE(i2c_mock_transfers.empty());
+}
+
+TEST_F(IS31FL3733, SingleLedSendsItsChunk) {
+    is31fl3733_set_color(7, 10, 20, 30);
+    is31fl3733_flush();
+
+    auto writes = pwm_writes();
+    ASSERT_EQ(writes.size(), 1);
+    EXPECT_EQ(writes[0].reg, 16);
+    ASSERT_EQ(writes[0].data.size(), 16);
+    EXPECT_EQ(writes[0].data[6], 10);
+    EXPECT_EQ(writes[0].data[7], 20);
+    EXPECT_EQ(writes[0].data[8], 30);
+
+    RecordProperty("single_led_bytes", std::to_string(i2c_mock_payload_bytes()));
+
+    i2c_mock_reset();
+    is31fl3733_flush();
+    EXPECT_TRUE(i2c_mock_transfers.empty());
+}
+
+TEST_F(IS31FL3733, AdjacentChunksAreMerged) {
+    is31fl3733_set_color(14, 1, 2, 3);
+    is31fl3733_set_color(5, 4, 5, 6);
+    is31fl3733_set_color(0, 7, 8, 9);
+    is31fl3733_flush();
+
+    auto writes = pwm_writes();
+    ASSERT_EQ(writes.size(), 1);
+    EXPECT_EQ(writes[0].reg, 0);
+    EXPECT_EQ(writes[0].data.size(), 48);
+}
+
+TEST_F(IS31FL3733, SeparateChunksAreSentSeparately) {
+    is31fl3733_set_color(0, 1, 2, 3);
+    is31fl3733_set_color(15, 4, 5, 6);
+    is31fl3733_set_color(59, 7, 8, 9);
+    is31fl3733_flush();
+
+    auto writes = pwm_writes();
+    ASSERT_EQ(writes.size(), 3);
+    EXPECT_EQ(writes[0].reg, 0);
+    EXPECT_EQ(writes[0].data.size(), 16);
+    EXPECT_EQ(writes[1].reg, 48);
+    EXPECT_EQ(writes[1].data.size(), 16);
+    EXPECT_EQ(writes[2].reg, 176);
+    EXPECT_EQ(writes[2].data.size(), 16);
+}
+
+TEST_F(IS31FL3733, FullFrameIsSentInOneTransfer) {
+    is31fl3733_set_color_all(255, 128, 64);
+    is31fl3733_flush();
+
+    auto writes = pwm_writes();
+    ASSERT_EQ(writes.size(), 1);
+    EXPECT_EQ(writes[0].reg, 0);
+    EXPECT_EQ(writes[0].data.size(), 192);
+
+    RecordProperty("full_frame_bytes", std::to_string(i2c_mock_payload_bytes()));
+}
+
+TEST_F(IS31FL3733, RegistersMatchBufferAfterPartialFlushes) {
+    std::array<uint8_t, 192> registers = {0};
+    std::array<uint8_t, 192> expected  = {0};
+
+    for (int frame = 0; frame < 50; frame++) {
+        for (int k = frame % 7; k < IS31FL3733_LED_COUNT; k += 11) {
+            uint8_t value = frame * 13 + k;
+            is31fl3733_set_color(k, value, value + 1, value + 2);
+            expected[k / 5 * 16 + k % 5 * 3]     = value;
+            expected[k / 5 * 16 + k % 5 * 3 + 1] = value + 1;
+            expected[k / 5 * 16 + k % 5 * 3 + 2] = value + 2;
+        }
+        is31fl3733_flush();
+
+        for (const I2CTransfer& transfer : pwm_writes()) {
+            std::copy(transfer.data.begin(), transfer.data.end(), registers.begin() + transfer.reg);
+        }
+        i2c_mock_reset();
+
+        ASSERT_EQ(registers, expected) << "frame " << frame;
+    }
+}
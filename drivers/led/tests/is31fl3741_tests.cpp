@@ -0,0 +1,95 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "i2c_mock.hpp"
+
+extern "C" {
+#include "is31fl3741.h"
+}
+
+const is31fl3741_led_t PROGMEM g_is31fl3741_leds[IS31FL3741_LED_COUNT] = {
+    {0, 0x000, 0x001, 0x002}, // PWM0, chunk 0
+    {0, 0x01E, 0x01F, 0x020}, // PWM0, chunk 1
+    {0, 0x03C, 0x03D, 0x03E}, // PWM0, chunk 2
+    {0, 0x0B1, 0x0B2, 0x0B3}, // PWM0, chunk 5
+    {0, 0x100, 0x101, 0x102}, // PWM1, chunk 0
+    {0, 0x126, 0x127, 0x128}, // PWM1, chunk 2
+    {0, 0x1A8, 0x1A9, 0x1AA}, // PWM1, chunk 8
+};
+
+class IS31FL3741 : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        is31fl3741_init_drivers();
+        is31fl3741_set_color_all(0, 0, 0);
+        is31fl3741_flush();
+        i2c_mock_reset();
+    }
+
+    // The transfers to the given PWM page, excluding the page selection itself
+    std::vector<I2CTransfer> pwm_writes(uint8_t pwm_page) {
+        std::vector<I2CTransfer> writes;
+        uint8_t                  page = 0xFF;
+
+        for (const I2CTransfer& transfer : i2c_mock_transfers) {
+            if (transfer.reg == IS31FL3741_REG_COMMAND) {
+                page = transfer.data[0];
+            } else if (transfer.reg != IS31FL3741_REG_COMMAND_WRITE_LOCK && page == pwm_page) {
+                writes.push_back(transfer);
+            }
+        }
+        return writes;
+    }
+
+    bool page_selected(uint8_t page) {
+        for (const I2CTransfer& transfer : i2c_mock_transfers) {
+            if (transfer.reg == IS31FL3741_REG_COMMAND && transfer.data[0] == page) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+TEST_F(IS31FL3741, FlushWithoutChangesSendsNothing) {
+    is31fl3741_flush();
+    EXPECT_TRUE(i2c_mock_transfers.empty());
+}
+
+TEST_F(IS31FL3741, OnlyDirtyPageIsSelected) {
+    is31fl3741_set_color(5, 1, 2, 3);
+    is31fl3741_flush();
+
+    EXPECT_FALSE(page_selected(IS31FL3741_COMMAND_PWM_0));
+    auto writes = pwm_writes(IS31FL3741_COMMAND_PWM_1);
+    ASSERT_EQ(writes.size(), 1);
+    EXPECT_EQ(writes[0].reg, 38);
+    ASSERT_EQ(writes[0].data.size(), 19);
+    EXPECT_EQ(writes[0].data[0], 1);
+    EXPECT_EQ(writes[0].data[1], 2);
+    EXPECT_EQ(writes[0].data[2], 3);
+}
+
+TEST_F(IS31FL3741, ChunksAreMergedPerPage) {
+    is31fl3741_set_color(0, 1, 1, 1);
+    is31fl3741_set_color(1, 2, 2, 2);
+    is31fl3741_set_color(3, 3, 3, 3);
+    is31fl3741_set_color(4, 4, 4, 4);
+    is31fl3741_set_color(6, 5, 5, 5);
+    is31fl3741_flush();
+
+    auto writes_0 = pwm_writes(IS31FL3741_COMMAND_PWM_0);
+    ASSERT_EQ(writes_0.size(), 2);
+    EXPECT_EQ(writes_0[0].reg, 0);
+    EXPECT_EQ(writes_0[0].data.size(), 60);
+    EXPECT_EQ(writes_0[1].reg, 150);
+    EXPECT_EQ(writes_0[1].data.size(), 30);
+
+    auto writes_1 = pwm_writes(IS31FL3741_COMMAND_PWM_1);
+    ASSERT_EQ(writes_1.size(), 2);
+    EXPECT_EQ(writes_1[0].reg, 0);
+    EXPECT_EQ(writes_1[0].data.size(), 19);
+    EXPECT_EQ(writes_1[1].reg, 152);
+    EXPECT_EQ(writes_1[1].data.size(), 19);
+}
@@ -0,0 +1,20 @@
+led_driver_common_SRC := \
+	platforms/test/timer.c \
+	$(DRIVER_PATH)/led/tests/i2c_mock.cpp
+led_driver_common_INC := \
+	$(DRIVER_PATH)/led/tests \
+	$(DRIVER_PATH)/led/issi
+
+is31fl3733_DEFS := -DIS31FL3733_I2C_ADDRESS_1=0x50 -DIS31FL3733_LED_COUNT=60
+is31fl3733_INC := $(led_driver_common_INC)
+is31fl3733_SRC := \
+	$(led_driver_common_SRC) \
+	$(DRIVER_PATH)/led/issi/is31fl3733.c \
+	$(DRIVER_PATH)/led/tests/is31fl3733_tests.cpp
+
+is31fl3741_DEFS := -DIS31FL3741_I2C_ADDRESS_1=0x30 -DIS31FL3741_LED_COUNT=7
+is31fl3741_INC := $(led_driver_common_INC)
+is31fl3741_SRC := \
+	$(led_driver_common_SRC) \
+	$(DRIVER_PATH)/led/issi/is31fl3741.c \
+	$(DRIVER_PATH)/led/tests/is31fl3741_tests.cpp
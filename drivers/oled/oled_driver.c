@@ -185,8 +185,95 @@ uint16_t oled_update_timeout;
 #    endif
 #endif
 
+#ifdef OLED_ASYNC_RENDER
+#    if OLED_IC_HAS_HORIZONTAL_MODE
+static const uint8_t oled_display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
+#    else
+static const uint8_t oled_display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
+#    endif
+
+// A dirty block snapshotted for transmission, sent as one or more pages
+typedef struct {
+    uint8_t  command[sizeof(oled_display_start)];
+    uint8_t  data[OLED_BLOCK_SIZE];
+    uint16_t page_size;
+    uint8_t  pages;
+    uint8_t  block;
+} oled_transfer_t;
+
+static oled_transfer_t oled_transfer_queue[OLED_ASYNC_QUEUE_SIZE];
+static uint8_t         oled_transfer_tail   = 0;
+static uint8_t         oled_transfer_count  = 0;
+static uint8_t         oled_transfer_page   = 0;
+static bool            oled_transfer_active = false;
+
+#    define OLED_TRANSFERS_PENDING (oled_transfer_count > 0)
+
+__attribute__((weak)) bool oled_send_data_async(const uint8_t *data, uint16_t size) {
+#    if defined(OLED_TRANSPORT_SPI) && defined(PROTOCOL_CHIBIOS)
+    if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
+        return false;
+    }
+    // Data Mode
+    gpio_write_pin_high(OLED_DC_PIN);
+    // Start the DMA transfer
+    if (spi_transmit_async(data, size) != SPI_STATUS_SUCCESS) {
+        spi_stop();
+        return false;
+    }
+    return true;
+#    else
+    // No non-blocking transfer available, send it straight away
+    return oled_send_data(data, size);
+#    endif
+}
+
+__attribute__((weak)) bool oled_send_async_complete(void) {
+#    if defined(OLED_TRANSPORT_SPI) && defined(PROTOCOL_CHIBIOS)
+    if (!spi_transmit_async_complete()) {
+        return false;
+    }
+    spi_stop();
+#    endif
+    return true;
+}
+
+static void oled_transfer_pop(void) {
+    oled_transfer_tail = (oled_transfer_tail + 1) % OLED_ASYNC_QUEUE_SIZE;
+    oled_transfer_page = 0;
+    oled_transfer_count--;
+}
+
+// Retires the page in flight once the bus is done with it, returns false while it is still busy
+static bool oled_transfer_retire(void) {
+    if (!oled_transfer_active) {
+        return true;
+    }
+    if (!oled_send_async_complete()) {
+        return false;
+    }
+
+    oled_transfer_active = false;
+    if (++oled_transfer_page >= oled_transfer_queue[oled_transfer_tail].pages) {
+        oled_transfer_pop();
+    }
+    return true;
+}
+
+// Commands share the bus with the data, so they have to wait for the page in flight
+static void oled_transfer_wait(void) {
+    while (!oled_transfer_retire()) {
+    }
+}
+#else
+#    define OLED_TRANSFERS_PENDING false
+#endif
+
 // Transmit/Write Funcs.
 __attribute__((weak)) bool oled_send_cmd(const uint8_t *data, uint16_t size) {
+#ifdef OLED_ASYNC_RENDER
+    oled_transfer_wait();
+#endif
 #if defined(OLED_TRANSPORT_SPI)
     if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
         return false;
@@ -208,6 +295,9 @@ __attribute__((weak)) bool oled_send_cmd(const uint8_t *data, uint16_t size) {
 }
 
 __attribute__((weak)) bool oled_send_cmd_P(const uint8_t *data, uint16_t size) {
+#ifdef OLED_ASYNC_RENDER
+    oled_transfer_wait();
+#endif
 #if defined(__AVR__)
 #    if defined(OLED_TRANSPORT_SPI)
     if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
@@ -234,6 +324,9 @@ __attribute__((weak)) bool oled_send_cmd_P(const uint8_t *data, uint16_t size) {
 }
 
 __attribute__((weak)) bool oled_send_data(const uint8_t *data, uint16_t size) {
+#ifdef OLED_ASYNC_RENDER
+    oled_transfer_wait();
+#endif
 #if defined(OLED_TRANSPORT_SPI)
     if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
         return false;
@@ -446,6 +539,96 @@ static void rotate_90(const uint8_t *src, uint8_t *dest) {
     }
 }
 
+#ifdef OLED_ASYNC_RENDER
+// Snapshots a dirty block into the transmit queue, so drawing can continue while it is sent
+static void oled_transfer_queue_block(uint8_t block) {
+    oled_transfer_t *transfer = &oled_transfer_queue[(oled_transfer_tail + oled_transfer_count) % OLED_ASYNC_QUEUE_SIZE];
+
+    memcpy(transfer->command, oled_display_start, sizeof(oled_display_start));
+    transfer->page_size = OLED_BLOCK_SIZE;
+    transfer->pages     = 1;
+    transfer->block     = block;
+
+    if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        calc_bounds(block, &transfer->command[1]); // Offset from I2C_CMD byte at the start
+        memcpy(transfer->data, &oled_buffer[OLED_BLOCK_SIZE * block], OLED_BLOCK_SIZE);
+    } else {
+        // Rotate the render chunks
+        const static uint8_t source_map[] = OLED_SOURCE_MAP;
+        const static uint8_t target_map[] = OLED_TARGET_MAP;
+
+        calc_bounds_90(block, &transfer->command[1]); // Offset from I2C_CMD byte at the start
+        memset(transfer->data, 0, OLED_BLOCK_SIZE);
+        for (uint8_t i = 0; i < sizeof(source_map); ++i) {
+            rotate_90(&oled_buffer[OLED_BLOCK_SIZE * block + source_map[i]], &transfer->data[target_map[i]]);
+        }
+#    if !OLED_IC_HAS_HORIZONTAL_MODE
+        // For SH1106 or SH1107 the data chunk must be split into separate pieces for each page
+        transfer->page_size = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8;
+        transfer->pages     = OLED_BLOCK_SIZE / transfer->page_size;
+#    endif
+    }
+
+    oled_transfer_count++;
+    oled_dirty &= ~((OLED_BLOCK_TYPE)1 << block);
+}
+
+// Sends the position of the next queued page and starts the transfer of its data
+static bool oled_transfer_start(void) {
+    oled_transfer_t *transfer = &oled_transfer_queue[oled_transfer_tail];
+
+    // Pages after the first one only exist in Page Addressing Mode, where command[1] holds the page
+    uint8_t command[sizeof(oled_display_start)];
+    memcpy(command, transfer->command, sizeof(command));
+    command[1] += oled_transfer_page;
+
+    if (!oled_send_cmd(command, ARRAY_SIZE(command))) {
+        print("oled_render offset command failed\n");
+    } else if (!oled_send_data_async(&transfer->data[transfer->page_size * oled_transfer_page], transfer->page_size)) {
+        print("oled_render data failed\n");
+    } else {
+        oled_transfer_active = true;
+        return true;
+    }
+
+    // Drop the block and render it again later
+    oled_dirty |= (OLED_BLOCK_TYPE)1 << transfer->block;
+    oled_transfer_pop();
+    return false;
+}
+
+void oled_render_dirty(bool all) {
+    oled_dirty &= OLED_ALL_BLOCKS_MASK;
+    if (!oled_initialized) {
+        return;
+    }
+
+    do {
+        // Nothing to do until the bus is done with the page in flight, unless waiting for all of them
+        if (!oled_transfer_retire()) {
+            continue;
+        }
+
+        // Fill the free slots of the queue with dirty blocks
+        if (oled_dirty && !oled_scrolling) {
+            // Turn on display if it is off
+            oled_on();
+
+            uint8_t block = 0;
+            while (oled_dirty && oled_transfer_count < OLED_ASYNC_QUEUE_SIZE) {
+                while (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << block))) {
+                    ++block;
+                }
+                oled_transfer_queue_block(block);
+            }
+        }
+
+        if (!oled_transfer_count || oled_scrolling || !oled_transfer_start()) {
+            return;
+        }
+    } while (all);
+}
+#else
 void oled_render_dirty(bool all) {
     // Do we have work to do?
     oled_dirty &= OLED_ALL_BLOCKS_MASK;
@@ -531,6 +714,7 @@ void oled_render_dirty(bool all) {
         oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
     }
 }
+#endif
 
 void oled_set_cursor(uint8_t col, uint8_t line) {
     uint16_t index = line * oled_rotation_width + col * OLED_FONT_WIDTH;
@@ -836,7 +1020,7 @@ bool oled_scroll_right(void) {
 
     // Dont enable scrolling if we need to update the display
     // This prevents scrolling of bad data from starting the scroll too early after init
-    if (!oled_dirty && !oled_scrolling) {
+    if (!oled_dirty && !OLED_TRANSFERS_PENDING && !oled_scrolling) {
         uint8_t display_scroll_right[] = {I2C_CMD, SCROLL_RIGHT, 0x00, oled_scroll_start, oled_scroll_speed, oled_scroll_end, 0x00, 0xFF, ACTIVATE_SCROLL};
         if (!oled_send_cmd(display_scroll_right, ARRAY_SIZE(display_scroll_right))) {
             print("oled_scroll_right cmd failed\n");
@@ -854,7 +1038,7 @@ bool oled_scroll_left(void) {
 
     // Dont enable scrolling if we need to update the display
     // This prevents scrolling of bad data from starting the scroll too early after init
-    if (!oled_dirty && !oled_scrolling) {
+    if (!oled_dirty && !OLED_TRANSFERS_PENDING && !oled_scrolling) {
         uint8_t display_scroll_left[] = {I2C_CMD, SCROLL_LEFT, 0x00, oled_scroll_start, oled_scroll_speed, oled_scroll_end, 0x00, 0xFF, ACTIVATE_SCROLL};
         if (!oled_send_cmd(display_scroll_left, ARRAY_SIZE(display_scroll_left))) {
             print("oled_scroll_left cmd failed\n");
@@ -321,6 +321,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define OLED_UPDATE_PROCESS_LIMIT 1
 #endif
 
+#if !defined(OLED_ASYNC_QUEUE_SIZE)
+#    define OLED_ASYNC_QUEUE_SIZE 4
+#endif
+
 typedef struct __attribute__((__packed__)) {
     uint8_t *current_element;
     uint16_t remaining_element_count;
@@ -344,6 +348,11 @@ bool oled_send_cmd_P(const uint8_t *data, uint16_t size);
 bool oled_send_data(const uint8_t *data, uint16_t size);
 void oled_driver_init(void);
 
+// Starts sending data to the screen and returns without waiting for the transfer, used by OLED_ASYNC_RENDER
+// data must stay valid until oled_send_async_complete() returns true
+bool oled_send_data_async(const uint8_t *data, uint16_t size);
+bool oled_send_async_complete(void);
+
 // Called at the start of oled_init, weak function overridable by the user
 // rotation - the value passed into oled_init
 // Return new oled_rotation_t if you want to override default rotation
@@ -357,7 +366,8 @@ void oled_clear(void);
 #define oled_render() oled_render_dirty(false)
 
 // Renders all dirty blocks to the display at one time or a subset depending on the value of
-// all.
+// all. With OLED_ASYNC_RENDER the blocks are queued and sent in the background instead, and
+// all waits until the queue is empty.
 void oled_render_dirty(bool all);
 
 // Moves cursor to character position indicated by column and line, wraps if out of bounds
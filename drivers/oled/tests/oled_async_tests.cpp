@@ -0,0 +1,236 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "i2c_master.h"
+#include "oled_driver.h"
+}
+
+#define SSD1306_CMD 0x00
+#define SSD1306_COLUMN_ADDR 0x21
+#define SSD1306_PAGE_ADDR 0x22
+
+// Model of an SSD1306 in horizontal addressing mode, fed through a DMA-like transfer that completes on demand
+struct MockDisplay {
+    std::array<uint8_t, OLED_MATRIX_SIZE> ram;
+
+    uint8_t column_start, column_end, page_start, page_end;
+    uint8_t column, page;
+
+    const uint8_t* pending_data;
+    uint16_t       pending_size;
+    bool           in_flight;
+    int            latency;
+    int            polls;
+    int            transfers_started;
+    bool           command_during_transfer;
+
+    void reset() {
+        ram.fill(0);
+        column_start = column = page_start = page = 0;
+        column_end                                = OLED_DISPLAY_WIDTH - 1;
+        page_end                                  = OLED_DISPLAY_HEIGHT / 8 - 1;
+        in_flight                                 = false;
+        latency                                   = -1;
+        transfers_started                         = 0;
+        command_during_transfer                   = false;
+    }
+
+    void command(const uint8_t* data, uint16_t length) {
+        if (in_flight) {
+            command_during_transfer = true;
+        }
+        if (length == 7 && data[0] == SSD1306_CMD && data[1] == SSD1306_COLUMN_ADDR && data[4] == SSD1306_PAGE_ADDR) {
+            column = column_start = data[2];
+            column_end            = data[3];
+            page = page_start = data[5];
+            page_end          = data[6];
+        }
+    }
+
+    void write(const uint8_t* data, uint16_t length) {
+        for (uint16_t i = 0; i < length; i++) {
+            ram[page * OLED_DISPLAY_WIDTH + column] = data[i];
+            if (column++ == column_end) {
+                column = column_start;
+                page   = page == page_end ? page_start : page + 1;
+            }
+        }
+    }
+
+    // Reads the data at the end of the transfer, as DMA would
+    void complete() {
+        ASSERT_TRUE(in_flight);
+        write(pending_data, pending_size);
+        in_flight = false;
+    }
+};
+
+static MockDisplay display;
+
+extern "C" {
+void i2c_init(void) {}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    display.command(data, length);
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    display.write(data, length);
+    return I2C_STATUS_SUCCESS;
+}
+
+bool oled_send_data_async(const uint8_t* data, uint16_t size) {
+    EXPECT_FALSE(display.in_flight);
+    display.pending_data = data;
+    display.pending_size = size;
+    display.in_flight    = true;
+    display.polls        = 0;
+    display.transfers_started++;
+    return true;
+}
+
+bool oled_send_async_complete(void) {
+    // A negative latency leaves completing the transfer to the test
+    if (display.in_flight && display.latency >= 0 && display.polls++ >= display.latency) {
+        display.complete();
+    }
+    return !display.in_flight;
+}
+}
+
+class OledAsync : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        display.reset();
+        display.latency = 0;
+        oled_init(OLED_ROTATION_0);
+        oled_render_dirty(true);
+        display.reset();
+    }
+
+    bool display_matches_buffer() {
+        oled_buffer_reader_t reader = oled_read_raw(0);
+        return std::memcmp(display.ram.data(), reader.current_element, OLED_MATRIX_SIZE) == 0;
+    }
+};
+
+TEST_F(OledAsync, RenderReturnsWhileTransferIsInFlight) {
+    oled_write_raw_byte(0x55, 0);
+    oled_write_raw_byte(0xAA, OLED_MATRIX_SIZE - 1);
+
+    oled_render();
+    EXPECT_EQ(display.transfers_started, 1);
+    EXPECT_TRUE(display.in_flight);
+
+    // The bus is still busy, so nothing else is started
+    oled_render();
+    oled_render();
+    EXPECT_EQ(display.transfers_started, 1);
+
+    display.complete();
+    oled_render();
+    EXPECT_EQ(display.transfers_started, 2);
+    display.complete();
+    oled_render();
+    EXPECT_EQ(display.transfers_started, 2);
+
+    EXPECT_TRUE(display_matches_buffer());
+    EXPECT_FALSE(display.command_during_transfer);
+}
+
+TEST_F(OledAsync, EachScanStartsAtMostOneTransfer) {
+    oled_buffer_reader_t reader = oled_read_raw(0);
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i++) {
+        oled_write_raw_byte(i * 7, i);
+    }
+
+    int scans = 0;
+    while (scans < 100) {
+        int started = display.transfers_started;
+        oled_render();
+        scans++;
+        if (!display.in_flight) {
+            break;
+        }
+        EXPECT_EQ(display.transfers_started, started + 1);
+        display.complete();
+    }
+
+    EXPECT_EQ(display.transfers_started, OLED_BLOCK_COUNT);
+    EXPECT_EQ(scans, OLED_BLOCK_COUNT + 1);
+    EXPECT_EQ(std::memcmp(display.ram.data(), reader.current_element, OLED_MATRIX_SIZE), 0);
+}
+
+TEST_F(OledAsync, DrawingDuringTransferIsNotLost) {
+    oled_write_raw_byte(0x01, 0);
+    oled_render();
+    ASSERT_TRUE(display.in_flight);
+
+    // Change the block being sent, and one already queued behind it
+    oled_write_raw_byte(0x02, 0);
+    oled_write_raw_byte(0x03, OLED_MATRIX_SIZE - 1);
+    display.complete();
+    EXPECT_EQ(display.ram[0], 0x01);
+
+    for (int scans = 0; scans < 10; scans++) {
+        oled_render();
+        if (display.in_flight) {
+            display.complete();
+        }
+    }
+
+    EXPECT_EQ(display.ram[0], 0x02);
+    EXPECT_EQ(display.ram[OLED_MATRIX_SIZE - 1], 0x03);
+    EXPECT_TRUE(display_matches_buffer());
+}
+
+TEST_F(OledAsync, RenderAllWaitsForEveryTransfer) {
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i += 3) {
+        oled_write_raw_byte(0xFF - i, i);
+    }
+
+    display.latency = 2;
+    oled_render_dirty(true);
+
+    EXPECT_FALSE(display.in_flight);
+    EXPECT_EQ(display.transfers_started, OLED_BLOCK_COUNT);
+    EXPECT_TRUE(display_matches_buffer());
+}
+
+TEST_F(OledAsync, CommandsWaitForTransferInFlight) {
+    oled_write_raw_byte(0x42, 0);
+    oled_render();
+    ASSERT_TRUE(display.in_flight);
+
+    display.latency = 3;
+    oled_set_brightness(10);
+
+    EXPECT_FALSE(display.in_flight);
+    EXPECT_FALSE(display.command_during_transfer);
+    EXPECT_EQ(display.ram[0], 0x42);
+}
+
+TEST_F(OledAsync, ScrollingWaitsForQueuedBlocks) {
+    oled_write_raw_byte(0x42, 0);
+    oled_write_raw_byte(0x24, OLED_MATRIX_SIZE - 1);
+    oled_render();
+    ASSERT_TRUE(display.in_flight);
+
+    // Both blocks have been taken from the dirty mask, but are not on the display yet
+    display.latency = 0;
+    EXPECT_FALSE(oled_scroll_left());
+
+    oled_render();
+    display.complete();
+    EXPECT_FALSE(oled_scroll_left());
+
+    oled_render();
+    EXPECT_TRUE(oled_scroll_left());
+    EXPECT_TRUE(oled_scroll_off());
+}
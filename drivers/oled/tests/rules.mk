@@ -0,0 +1,8 @@
+oled_driver_async_DEFS := -DOLED_TRANSPORT_I2C -DOLED_DISPLAY_128X32 -DOLED_ASYNC_RENDER -DOLED_ASYNC_QUEUE_SIZE=2
+oled_driver_async_INC := \
+	$(DRIVER_PATH)/oled/tests \
+	$(DRIVER_PATH)/oled
+oled_driver_async_SRC := \
+	platforms/test/timer.c \
+	$(DRIVER_PATH)/oled/oled_driver.c \
+	$(DRIVER_PATH)/oled/tests/oled_async_tests.cpp
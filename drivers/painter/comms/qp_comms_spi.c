@@ -45,6 +45,44 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
     return byte_count - bytes_remaining;
 }
 
+#    ifdef PROTOCOL_CHIBIOS
+
+// Only one non-blocking transfer can be in flight, as the SPI bus stays started until it completes
+static const uint8_t *async_data            = NULL;
+static uint32_t       async_bytes_remaining = 0;
+
+static bool qp_comms_spi_send_next_async_chunk(void) {
+    uint16_t bytes_this_chunk = QP_MIN(async_bytes_remaining, UINT16_MAX);
+    if (spi_transmit_async(async_data, bytes_this_chunk) != SPI_STATUS_SUCCESS) {
+        async_bytes_remaining = 0;
+        return false;
+    }
+    async_data += bytes_this_chunk;
+    async_bytes_remaining -= bytes_this_chunk;
+    return true;
+}
+
+bool qp_comms_spi_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    async_data            = (const uint8_t *)data;
+    async_bytes_remaining = byte_count;
+    return byte_count == 0 || qp_comms_spi_send_next_async_chunk();
+}
+
+bool qp_comms_spi_send_data_async_complete(painter_device_t device) {
+    if (!spi_transmit_async_complete()) {
+        return false;
+    }
+
+    // DMA transfers are limited to 64kB, so larger buffers go out in several chunks
+    if (async_bytes_remaining > 0 && qp_comms_spi_send_next_async_chunk()) {
+        return false;
+    }
+
+    return true;
+}
+
+#    endif // PROTOCOL_CHIBIOS
+
 void qp_comms_spi_stop(painter_device_t device) {
     painter_driver_t *     driver       = (painter_driver_t *)device;
     qp_comms_spi_config_t *comms_config = (qp_comms_spi_config_t *)driver->comms_config;
@@ -57,6 +95,10 @@ const painter_comms_vtable_t spi_comms_vtable = {
     .comms_start = qp_comms_spi_start,
     .comms_send  = qp_comms_spi_send_data,
     .comms_stop  = qp_comms_spi_stop,
+#    ifdef PROTOCOL_CHIBIOS
+    .comms_send_async          = qp_comms_spi_send_data_async,
+    .comms_send_async_complete = qp_comms_spi_send_data_async_complete,
+#    endif // PROTOCOL_CHIBIOS
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +139,15 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
     return qp_comms_spi_send_data(device, data, byte_count);
 }
 
+#        ifdef PROTOCOL_CHIBIOS
+bool qp_comms_spi_dc_reset_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    painter_driver_t *              driver       = (painter_driver_t *)device;
+    qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    gpio_write_pin_high(comms_config->dc_pin);
+    return qp_comms_spi_send_data_async(device, data, byte_count);
+}
+#        endif // PROTOCOL_CHIBIOS
+
 void qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *              driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
@@ -135,6 +186,10 @@ const painter_comms_with_command_vtable_t spi_comms_with_dc_vtable = {
             .comms_start = qp_comms_spi_start,
             .comms_send  = qp_comms_spi_dc_reset_send_data,
             .comms_stop  = qp_comms_spi_stop,
+#        ifdef PROTOCOL_CHIBIOS
+            .comms_send_async          = qp_comms_spi_dc_reset_send_data_async,
+            .comms_send_async_complete = qp_comms_spi_send_data_async_complete,
+#        endif // PROTOCOL_CHIBIOS
         },
     .send_command          = qp_comms_spi_dc_reset_send_command,
     .bulk_command_sequence = qp_comms_spi_dc_reset_bulk_command_sequence,
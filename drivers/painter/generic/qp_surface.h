@@ -40,6 +40,17 @@ typedef struct surface_painter_device_t surface_painter_device_t;
  */
 painter_device_t qp_make_rgb565_surface(uint16_t panel_width, uint16_t panel_height, void *buffer);
 
+/**
+ * Factory method for a double-buffered RGB565 surface, which can be flushed to a display with qp_flush_async().
+ *
+ * @param panel_width[in] the width of the display panel
+ * @param panel_height[in] the height of the display panel
+ * @param buffer[in] pointer to a preallocated uint8_t buffer of size `SURFACE_REQUIRED_BUFFER_BYTE_SIZE(panel_width, panel_height, 16)`, which is drawn into
+ * @param front_buffer[in] pointer to a second preallocated buffer of the same size, which is streamed to the display
+ * @return the device handle used with all drawing routines in Quantum Painter
+ */
+painter_device_t qp_make_rgb565_double_buffered_surface(uint16_t panel_width, uint16_t panel_height, void *buffer, void *front_buffer);
+
 /**
  * Factory method for a 1bpp monochrome surface (aka framebuffer).
  *
@@ -64,4 +75,39 @@ painter_device_t qp_make_mono1bpp_surface(uint16_t panel_width, uint16_t panel_h
  */
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface);
 
+/**
+ * Starts drawing the contents of a double-buffered surface to the target device, without waiting for the transfer.
+ *
+ * The dirty region is copied to the front buffer and streamed out from there, so drawing to the surface can continue
+ * while the transfer is in progress. The dirty area is reset once the transfer has started. Surfaces which aren't
+ * double-buffered, and targets which can't stream asynchronously, fall back to qp_surface_draw().
+ *
+ * The target device (and anything else on the same bus) must not be used until the flush has completed.
+ *
+ * @param surface[in] the surface to copy from
+ * @param target[in] the target device to copy into
+ * @param x[in] the x-location of the original position of the framebuffer
+ * @param y[in] the y-location of the original position of the framebuffer
+ * @param entire_surface[in] whether the entire surface should be drawn, instead of just the rows containing the dirty region
+ * @return whether the draw operation started successfully; false if the previous flush is still in progress
+ */
+bool qp_flush_async(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface);
+
+/**
+ * Checks whether the last qp_flush_async() of the surface has completed, releasing the target device if so.
+ *
+ * Also polled from the Quantum Painter task, so calling this is optional.
+ *
+ * @param surface[in] the surface which was flushed
+ * @return whether no flush is in progress
+ */
+bool qp_flush_async_complete(painter_device_t surface);
+
+/**
+ * Waits for the last qp_flush_async() of the surface to complete.
+ *
+ * @param surface[in] the surface which was flushed
+ */
+void qp_flush_async_wait(painter_device_t surface);
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
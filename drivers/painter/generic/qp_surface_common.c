@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "color.h"
+#include "qp_comms.h"
 #include "qp_draw.h"
 #include "qp_surface_internal.h"
 
@@ -49,13 +50,39 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
     }
 }
 
+// Copy the dirty region into the front buffer, so that the two buffers only ever differ by what's been drawn since the last flush
+static void qp_surface_update_front_buffer(surface_painter_device_t *surface) {
+    if (!surface->front_buffer || !surface->dirty.is_dirty) {
+        return;
+    }
+
+    uint8_t  bytes_per_pixel = surface->base.native_bits_per_pixel / 8;
+    uint32_t row_bytes       = (uint32_t)(surface->dirty.r - surface->dirty.l + 1) * bytes_per_pixel;
+    for (uint16_t y = surface->dirty.t; y <= surface->dirty.b; ++y) {
+        uint32_t offset = ((uint32_t)y * surface->base.panel_width + surface->dirty.l) * bytes_per_pixel;
+        memcpy((uint8_t *)surface->front_buffer + offset, surface->u8buffer + offset, row_bytes);
+    }
+}
+
+void qp_surface_internal_async_tick(void) {
+    for (uint8_t i = 0; i < SURFACE_NUM_DEVICES; ++i) {
+        if (surface_drivers[i].async_target) {
+            qp_flush_async_complete((painter_device_t)&surface_drivers[i]);
+        }
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Driver vtable
 
 bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     painter_driver_t *        driver  = (painter_driver_t *)device;
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
+    qp_flush_async_wait(device);
     memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
+    if (surface->front_buffer) {
+        memset(surface->front_buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
+    }
 
     surface->dirty.l        = 0;
     surface->dirty.t        = 0;
@@ -110,6 +137,9 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
     painter_driver_t *        target_driver  = (painter_driver_t *)target;
 
+    // The target can't be used while a non-blocking flush is still streaming to it
+    qp_flush_async_wait(surface);
+
     // If we're not dirty... we're done.
     if (!surface_handle->dirty.is_dirty) {
         qp_dprintf("qp_surface_draw: ok (not dirty, skipping)\n");
@@ -130,6 +160,9 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
         return false;
     }
 
+    // Keep the front buffer in sync for the next non-blocking flush
+    qp_surface_update_front_buffer(surface_handle);
+
     // Clear the dirty info for the surface
     ok = qp_flush(surface);
     if (!ok) {
@@ -139,3 +172,75 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
     qp_dprintf("qp_surface_draw: ok\n");
     return true;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Non-blocking variant of the above, streaming out of the front buffer of a double-buffered surface
+
+bool qp_flush_async(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface) {
+    painter_driver_t *        surface_driver = (painter_driver_t *)surface;
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+    painter_driver_t *        target_driver  = (painter_driver_t *)target;
+
+    // Only one flush can be in flight, as the front buffer and the target are still in use
+    if (!qp_flush_async_complete(surface)) {
+        qp_dprintf("qp_flush_async: fail (previous flush still in progress)\n");
+        return false;
+    }
+
+    // If we're not dirty... we're done.
+    if (!surface_handle->dirty.is_dirty) {
+        qp_dprintf("qp_flush_async: ok (not dirty, skipping)\n");
+        return true;
+    }
+
+    // If we have incompatible bit depths, drop out
+    if (surface_driver->native_bits_per_pixel != target_driver->native_bits_per_pixel) {
+        qp_dprintf("qp_flush_async: fail (incompatible bpp: surface=%d, target=%d)\n", (int)surface_driver->native_bits_per_pixel, (int)target_driver->native_bits_per_pixel);
+        return false;
+    }
+
+    // Without a front buffer, or a target which can stream asynchronously, fall back to a blocking draw
+    surface_painter_driver_vtable_t *vtable = (surface_painter_driver_vtable_t *)surface_driver->driver_vtable;
+    if (!surface_handle->front_buffer || !vtable->target_pixdata_transfer_async || !target_driver->driver_vtable->pixdata_async) {
+        qp_dprintf("qp_flush_async: falling back to qp_surface_draw\n");
+        return qp_surface_draw(surface, target, x, y, entire_surface);
+    }
+
+    // Snapshot what's been drawn, then start streaming it out
+    qp_surface_update_front_buffer(surface_handle);
+    bool ok = vtable->target_pixdata_transfer_async(surface_driver, target_driver, x, y, entire_surface);
+    if (!ok) {
+        qp_dprintf("qp_flush_async: fail (could not start pixel data transfer)\n");
+        return false;
+    }
+    surface_handle->async_target = target_driver;
+
+    // Clear the dirty info for the surface, drawing can continue straight away
+    ok = qp_flush(surface);
+    if (!ok) {
+        qp_dprintf("qp_flush_async: fail (could not flush)\n");
+        return false;
+    }
+    qp_dprintf("qp_flush_async: ok\n");
+    return true;
+}
+
+bool qp_flush_async_complete(painter_device_t surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface;
+    if (!surface_handle->async_target) {
+        return true;
+    }
+
+    if (!qp_comms_send_async_complete((painter_device_t)surface_handle->async_target)) {
+        return false;
+    }
+
+    qp_comms_stop((painter_device_t)surface_handle->async_target);
+    surface_handle->async_target = NULL;
+    return true;
+}
+
+void qp_flush_async_wait(painter_device_t surface) {
+    while (!qp_flush_async_complete(surface)) {
+    }
+}
@@ -14,6 +14,9 @@ typedef struct surface_painter_driver_vtable_t {
     painter_driver_vtable_t base; // must be first, so it can be cast to/from the painter_driver_vtable_t* type
 
     bool (*target_pixdata_transfer)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface);
+
+    // Optional: starts streaming the front buffer to the target without waiting for the transfer to complete
+    bool (*target_pixdata_transfer_async)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface);
 } surface_painter_driver_vtable_t;
 
 typedef struct surface_dirty_data_t {
@@ -52,6 +55,12 @@ typedef struct surface_painter_device_t {
 
     // Maintain a dirty region so we can stream only what we need
     surface_dirty_data_t dirty;
+
+    // Double buffering: a copy of the buffer which is streamed out while drawing continues, or NULL
+    void *front_buffer;
+
+    // The target of the non-blocking flush in flight, or NULL
+    painter_driver_t *async_target;
 } surface_painter_device_t;
 
 /**
@@ -89,6 +98,7 @@ bool qp_surface_flush(painter_device_t device);
 bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
 void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport);
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y);
+void qp_surface_internal_async_tick(void);
 
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
 
@@ -109,6 +119,8 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
                 driver->base.offset_x              = 0;                                                                                                                       \
                 driver->base.offset_y              = 0;                                                                                                                       \
                 driver->buffer                     = buffer;                                                                                                                  \
+                driver->front_buffer               = NULL;                                                                                                                    \
+                driver->async_target               = NULL;                                                                                                                    \
                 return (painter_device_t)driver;                                                                                                                              \
             }                                                                                                                                                                 \
         }                                                                                                                                                                     \
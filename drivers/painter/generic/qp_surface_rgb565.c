@@ -3,7 +3,10 @@
 
 #ifdef QUANTUM_PAINTER_SURFACE_ENABLE
 
+#    include <string.h>
+
 #    include "color.h"
+#    include "qp_comms.h"
 #    include "qp_draw.h"
 #    include "qp_surface_internal.h"
 #    include "qp_comms_dummy.h"
@@ -68,6 +71,24 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
+// Append pixels to the target location, decoding palette indices packed at the supplied bpp
+static bool qp_surface_append_packed_rgb565(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t bits_per_pixel, const uint8_t *packed_indices) {
+    uint16_t *    buf           = (uint16_t *)target_buffer + pixel_offset;
+    const uint8_t pixel_bitmask = (1 << bits_per_pixel) - 1;
+    uint8_t       byteval       = 0;
+    uint8_t       bits          = 0;
+    for (uint32_t i = 0; i < pixel_count; ++i) {
+        if (bits == 0) {
+            byteval = *packed_indices++;
+            bits    = 8;
+        }
+        buf[i] = palette[byteval & pixel_bitmask].rgb565;
+        byteval >>= bits_per_pixel;
+        bits -= bits_per_pixel;
+    }
+    return true;
+}
+
 static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
 
@@ -119,11 +140,47 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     return true;
 }
 
+static bool rgb565_target_pixdata_transfer_async(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+
+    uint16_t w = surface_handle->base.panel_width;
+    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
+    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
+
+    // Whole rows are contiguous in the front buffer, so every row containing the dirty region goes out as a single transfer
+    bool ok = qp_viewport((painter_device_t)target_driver, x, y + t, x + w - 1, y + b);
+    if (!ok) {
+        qp_dprintf("rgb565_target_pixdata_transfer_async: fail (could not set target viewport)\n");
+        return false;
+    }
+
+    // The target stays started until qp_flush_async_complete() sees the transfer finish
+    if (!qp_comms_start((painter_device_t)target_driver)) {
+        qp_dprintf("rgb565_target_pixdata_transfer_async: fail (could not start comms)\n");
+        return false;
+    }
+
+    const uint16_t *front_buffer = (const uint16_t *)surface_handle->front_buffer;
+    ok                           = target_driver->driver_vtable->pixdata_async((painter_device_t)target_driver, &front_buffer[(uint32_t)t * w], (uint32_t)(b - t + 1) * w);
+    if (!ok) {
+        qp_dprintf("rgb565_target_pixdata_transfer_async: fail (could not stream pixdata to target)\n");
+        qp_comms_stop((painter_device_t)target_driver);
+        return false;
+    }
+
+    return true;
+}
+
 static bool qp_surface_append_pixdata_rgb565(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
     target_buffer[pixdata_offset] = pixdata_byte;
     return true;
 }
 
+static bool qp_surface_append_pixspan_rgb565(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, const uint8_t *pixdata, uint32_t byte_count) {
+    memcpy(&target_buffer[pixdata_offset], pixdata, byte_count);
+    return true;
+}
+
 const surface_painter_driver_vtable_t rgb565_surface_driver_vtable = {
     .base =
         {
@@ -136,10 +193,21 @@ const surface_painter_driver_vtable_t rgb565_surface_driver_vtable = {
             .palette_convert = qp_surface_palette_convert_rgb565_swapped,
             .append_pixels   = qp_surface_append_pixels_rgb565,
             .append_pixdata  = qp_surface_append_pixdata_rgb565,
+            .append_packed   = qp_surface_append_packed_rgb565,
+            .append_pixspan  = qp_surface_append_pixspan_rgb565,
         },
-    .target_pixdata_transfer = rgb565_target_pixdata_transfer,
+    .target_pixdata_transfer       = rgb565_target_pixdata_transfer,
+    .target_pixdata_transfer_async = rgb565_target_pixdata_transfer_async,
 };
 
 SURFACE_FACTORY_FUNCTION_IMPL(qp_make_rgb565_surface, rgb565_surface_driver_vtable, 16);
 
+painter_device_t qp_make_rgb565_double_buffered_surface(uint16_t panel_width, uint16_t panel_height, void *buffer, void *front_buffer) {
+    surface_painter_device_t *surface = (surface_painter_device_t *)qp_make_rgb565_surface(panel_width, panel_height, buffer);
+    if (surface) {
+        surface->front_buffer = front_buffer;
+    }
+    return (painter_device_t)surface;
+}
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
@@ -189,10 +189,13 @@ const tft_panel_dc_reset_painter_driver_vtable_t ili9486_driver_vtable = {
             .clear           = qp_tft_panel_clear,
             .flush           = qp_tft_panel_flush,
             .pixdata         = qp_tft_panel_pixdata,
+            .pixdata_async   = qp_tft_panel_pixdata_async,
             .viewport        = qp_tft_panel_viewport,
             .palette_convert = qp_tft_panel_palette_convert_rgb565_swapped,
             .append_pixels   = qp_tft_panel_append_pixels_rgb565,
             .append_pixdata  = qp_tft_panel_append_pixdata,
+            .append_packed   = qp_tft_panel_append_packed_rgb565,
+            .append_pixspan  = qp_tft_panel_append_pixspan,
         },
     .num_window_bytes   = 2,
     .swap_window_coords = false,
@@ -215,10 +218,13 @@ const tft_panel_dc_reset_painter_driver_vtable_t ili9486_waveshare_driver_vtable
             .clear           = qp_tft_panel_clear,
             .flush           = qp_tft_panel_flush,
             .pixdata         = qp_tft_panel_pixdata,
+            .pixdata_async   = qp_tft_panel_pixdata_async,
             .viewport        = qp_ili9486_viewport,
             .palette_convert = qp_tft_panel_palette_convert_rgb565_swapped,
             .append_pixels   = qp_tft_panel_append_pixels_rgb565,
             .append_pixdata  = qp_tft_panel_append_pixdata,
+            .append_packed   = qp_tft_panel_append_packed_rgb565,
+            .append_pixspan  = qp_tft_panel_append_pixspan,
         },
     .num_window_bytes   = 2,
     .swap_window_coords = false,
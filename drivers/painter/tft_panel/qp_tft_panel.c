@@ -1,6 +1,8 @@
 // Copyright 2021 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
+
 #include "color.h"
 #include "qp_internal.h"
 #include "qp_comms.h"
@@ -85,6 +87,12 @@ bool qp_tft_panel_pixdata(painter_device_t device, const void *pixel_data, uint3
     return true;
 }
 
+// Stream pixel data to the current write position in GRAM, without waiting for the transfer to complete
+bool qp_tft_panel_pixdata_async(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    return qp_comms_send_async(device, pixel_data, native_pixel_count * driver->native_bits_per_pixel / 8);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Convert supplied palette entries into their native equivalents
 
@@ -127,7 +135,49 @@ bool qp_tft_panel_append_pixels_rgb888(painter_device_t device, uint8_t *target_
     return true;
 }
 
+bool qp_tft_panel_append_packed_rgb565(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t bits_per_pixel, const uint8_t *packed_indices) {
+    uint16_t *    buf           = (uint16_t *)target_buffer + pixel_offset;
+    const uint8_t pixel_bitmask = (1 << bits_per_pixel) - 1;
+    uint8_t       byteval       = 0;
+    uint8_t       bits          = 0;
+    for (uint32_t i = 0; i < pixel_count; ++i) {
+        if (bits == 0) {
+            byteval = *packed_indices++;
+            bits    = 8;
+        }
+        buf[i] = palette[byteval & pixel_bitmask].rgb565;
+        byteval >>= bits_per_pixel;
+        bits -= bits_per_pixel;
+    }
+    return true;
+}
+
+bool qp_tft_panel_append_packed_rgb888(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t bits_per_pixel, const uint8_t *packed_indices) {
+    uint8_t *     buf           = target_buffer + pixel_offset * 3;
+    const uint8_t pixel_bitmask = (1 << bits_per_pixel) - 1;
+    uint8_t       byteval       = 0;
+    uint8_t       bits          = 0;
+    for (uint32_t i = 0; i < pixel_count; ++i) {
+        if (bits == 0) {
+            byteval = *packed_indices++;
+            bits    = 8;
+        }
+        qp_pixel_t *pixel = &palette[byteval & pixel_bitmask];
+        *buf++            = pixel->rgb888.r;
+        *buf++            = pixel->rgb888.g;
+        *buf++            = pixel->rgb888.b;
+        byteval >>= bits_per_pixel;
+        bits -= bits_per_pixel;
+    }
+    return true;
+}
+
 bool qp_tft_panel_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
     target_buffer[pixdata_offset] = pixdata_byte;
     return true;
 }
+
+bool qp_tft_panel_append_pixspan(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, const uint8_t *pixdata, uint32_t byte_count) {
+    memcpy(&target_buffer[pixdata_offset], pixdata, byte_count);
+    return true;
+}
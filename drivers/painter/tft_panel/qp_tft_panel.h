@@ -54,6 +54,7 @@ bool qp_tft_panel_clear(painter_device_t device);
 bool qp_tft_panel_flush(painter_device_t device);
 bool qp_tft_panel_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
 bool qp_tft_panel_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count);
+bool qp_tft_panel_pixdata_async(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count);
 
 bool qp_tft_panel_palette_convert_rgb565_swapped(painter_device_t device, int16_t palette_size, qp_pixel_t *palette);
 bool qp_tft_panel_palette_convert_rgb888(painter_device_t device, int16_t palette_size, qp_pixel_t *palette);
@@ -61,4 +62,8 @@ bool qp_tft_panel_palette_convert_rgb888(painter_device_t device, int16_t palett
 bool qp_tft_panel_append_pixels_rgb565(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices);
 bool qp_tft_panel_append_pixels_rgb888(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices);
 
+bool qp_tft_panel_append_packed_rgb565(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t bits_per_pixel, const uint8_t *packed_indices);
+bool qp_tft_panel_append_packed_rgb888(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t bits_per_pixel, const uint8_t *packed_indices);
+
 bool qp_tft_panel_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte);
+bool qp_tft_panel_append_pixspan(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, const uint8_t *pixdata, uint32_t byte_count);
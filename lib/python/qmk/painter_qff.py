@@ -136,6 +136,7 @@ class QFFUnicodeGlyphTableV1:
         self.header.length = len(self.glyphs.keys()) * 6
         self.header.write(fp)
 
+        # Glyphs must be in ascending code point order, as the firmware binary-searches this table
         for n in sorted(self.glyphs.keys()):
             self.glyphs[n].write(fp, True)
 
@@ -17,7 +17,6 @@
 
 #include "audio.h"
 #include "gpio.h"
-#include <math.h>
 #include "util.h"
 
 // Need to disable GCC's "tautological-compare" warning for this file, as it causes issues when running `KEEP_INTERMEDIATES=yes`. Corresponding pop at the end of the file.
@@ -90,11 +89,23 @@ static const dacsample_t dac_buffer_trapezoid[] = {
 
 static dacsample_t dac_buffer[AUDIO_DAC_BUFFER_SIZE];
 
-/* keep track of the sample position for for each frequency */
-static float dac_if[AUDIO_MAX_SIMULTANEOUS_TONES] = {0.0};
+/* keep track of the sample position for for each frequency, as a phase accumulator
+ * where the full uint32_t range spans one period of the wavetable */
+static uint32_t dac_if[AUDIO_MAX_SIMULTANEOUS_TONES] = {0};
 
-static float   active_tones_snapshot[AUDIO_MAX_SIMULTANEOUS_TONES] = {0};
-static uint8_t active_tones_snapshot_length                        = 0;
+/* phase increments per sample of the active tones, precomputed whenever they change */
+static uint32_t active_tones_snapshot[AUDIO_MAX_SIMULTANEOUS_TONES] = {0};
+static uint8_t  active_tones_snapshot_length                        = 0;
+
+/* converts a Q16.16 frequency into the phase increment per sample
+ * Note: the 2/3 are necessary to get the correct frequencies on the
+ *       DAC output (as measured with an oscilloscope), since the gpt
+ *       timer runs with 3*AUDIO_DAC_SAMPLE_RATE; and the DAC callback
+ *       is called twice per conversion.
+ */
+static uint32_t dac_phase_increment(audio_freq_t frequency) {
+    return (uint32_t)((((uint64_t)frequency << (32 - AUDIO_FREQ_FRACTION_BITS)) * 2) / (3 * AUDIO_DAC_SAMPLE_RATE));
+}
 
 typedef enum {
     OUTPUT_SHOULD_START,
@@ -125,8 +136,7 @@ __attribute__((weak)) uint16_t dac_value_generate(void) {
     /* doing additive wave synthesis over all currently playing tones = adding up
      * sine-wave-samples for each frequency, scaled by the number of active tones
      */
-    uint_fast16_t value     = 0;
-    float         frequency = 0.0f;
+    uint_fast16_t value = 0;
 
 #if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
     const size_t wavetable_length = ARRAY_SIZE(dac_buffer_sine);
@@ -140,22 +150,11 @@ __attribute__((weak)) uint16_t dac_value_generate(void) {
 
     for (size_t i = 0; i < active_tones_snapshot_length; i++) {
         /* Note: a user implementation does not have to rely on the active_tones_snapshot, but
-         * could directly query the active frequencies through audio_get_processed_frequency */
-        frequency = active_tones_snapshot[i];
-
-        float new_dac_if = dac_if[i];
-        new_dac_if += frequency * ((float)wavetable_length / AUDIO_DAC_SAMPLE_RATE * 2.0f / 3.0f);
-        /*Note: the 2/3 are necessary to get the correct frequencies on the
-         *      DAC output (as measured with an oscilloscope), since the gpt
-         *      timer runs with 3*AUDIO_DAC_SAMPLE_RATE; and the DAC callback
-         *      is called twice per conversion.*/
-
-        while (new_dac_if >= wavetable_length)
-            new_dac_if -= wavetable_length;
-        dac_if[i] = new_dac_if;
+         * could directly query the active frequencies through audio_get_processed_frequency_fixed */
+        dac_if[i] += active_tones_snapshot[i]; // wraps around at the end of each period
 
         // Wavetable generation/lookup
-        size_t dac_i = (size_t)new_dac_if;
+        size_t dac_i = ((dac_if[i] >> 16) * wavetable_length) >> 16;
 
 #if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
         value += dac_buffer_sine[dac_i] / active_tones_snapshot_length;
@@ -241,9 +240,9 @@ static void dac_end(DACDriver *dacp) {
             // update the snapshot - once, and only on occasion that something changed;
             // -> saves cpu cycles (?)
             for (uint8_t i = 0; i < active_tones; i++) {
-                float freq = audio_get_processed_frequency(i);
-                if (freq > 0) { // disregard 'rest' notes, with valid frequency 0.0f; which would only lower the resulting waveform volume during the additive synthesis step
-                    active_tones_snapshot[active_tones_snapshot_length++] = freq;
+                audio_freq_t freq = audio_get_processed_frequency_fixed(i);
+                if (freq > 0) { // disregard 'rest' notes, with valid frequency 0; which would only lower the resulting waveform volume during the additive synthesis step
+                    active_tones_snapshot[active_tones_snapshot_length++] = dac_phase_increment(freq);
                 }
             }
 
@@ -358,8 +357,8 @@ void audio_driver_start_impl(void) {
     gptStartContinuous(&GPTD6, 2U);
 
     for (uint8_t i = 0; i < AUDIO_MAX_SIMULTANEOUS_TONES; i++) {
-        dac_if[i]                = 0.0f;
-        active_tones_snapshot[i] = 0.0f;
+        dac_if[i]                = 0;
+        active_tones_snapshot[i] = 0;
     }
     active_tones_snapshot_length = 0;
     state                        = OUTPUT_SHOULD_START;
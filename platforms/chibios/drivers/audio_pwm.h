@@ -38,3 +38,7 @@
 // Tim6 is the default for "larger" STMs, smaller ones might not have this one (enabled) and need to switch to a different one (e.g.: STM32F103 has only Tim1-Tim4)
 #    define AUDIO_STATE_TIMER GPTD6
 #endif
+
+// pwm period in counter ticks for a Q16.16 frequency; the frequency is truncated to 1/256 Hz
+// so that this stays a 32bit division for counter frequencies of up to 16MHz
+#define AUDIO_PWM_PERIOD(counter_frequency, freq) (((uint32_t)(counter_frequency) << 8) / (((freq) >> 8) ? ((freq) >> 8) : 1))
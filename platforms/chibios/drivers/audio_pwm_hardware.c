@@ -37,17 +37,17 @@ static PWMConfig pwmCFG = {.frequency = AUDIO_PWM_COUNTER_FREQUENCY, /* PWM cloc
                            .callback  = NULL,
                            .channels  = {[(AUDIO_PWM_CHANNEL - 1)] = {.mode = AUDIO_PWM_OUTPUT_MODE, .callback = NULL}}};
 
-static float channel_1_frequency = 0.0f;
+static audio_freq_t channel_1_frequency = 0;
 
-void channel_1_set_frequency(float freq) {
+void channel_1_set_frequency(audio_freq_t freq) {
     channel_1_frequency = freq;
 
-    if (freq <= 0.0) {
+    if (freq == 0) {
         // a pause/rest has freq=0
         return;
     }
 
-    pwmcnt_t period = (pwmCFG.frequency / freq);
+    pwmcnt_t period = AUDIO_PWM_PERIOD(pwmCFG.frequency, freq);
     chSysLockFromISR();
     pwmChangePeriodI(&AUDIO_PWM_DRIVER, period);
     pwmEnableChannelI(&AUDIO_PWM_DRIVER, AUDIO_PWM_CHANNEL - 1,
@@ -56,7 +56,7 @@ void channel_1_set_frequency(float freq) {
     chSysUnlockFromISR();
 }
 
-float channel_1_get_frequency(void) {
+audio_freq_t channel_1_get_frequency(void) {
     return channel_1_frequency;
 }
 
@@ -75,10 +75,10 @@ static void            audio_callback(virtual_timer_t *vtp, void *p);
 // a regular timer task, that checks the note to be currently played and updates
 // the pwm to output that frequency.
 static void audio_callback(virtual_timer_t *vtp, void *p) {
-    float freq; // TODO: freq_alt
+    audio_freq_t freq; // TODO: freq_alt
 
     if (audio_update_state()) {
-        freq = audio_get_processed_frequency(0); // freq_alt would be index=1
+        freq = audio_get_processed_frequency_fixed(0); // freq_alt would be index=1
         channel_1_set_frequency(freq);
     }
 
@@ -399,6 +399,19 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    if (!spiStarted || SPI_DRIVER.state != SPI_READY) {
+        return SPI_STATUS_ERROR;
+    }
+
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+bool spi_transmit_async_complete(void) {
+    return SPI_DRIVER.state != SPI_ACTIVE;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
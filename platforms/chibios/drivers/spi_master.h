@@ -94,6 +94,11 @@ spi_status_t spi_read(void);
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+// Starts a DMA transmit and returns immediately; `data` must stay valid until spi_transmit_async_complete() returns true
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+bool spi_transmit_async_complete(void);
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length);
 
 void spi_stop(void);
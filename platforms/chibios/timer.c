@@ -98,8 +98,9 @@ uint16_t timer_read(void) {
     return (uint16_t)timer_read32();
 }
 
-uint32_t timer_read32(void) {
-    chSysLock();
+// Get the system ticks since the last timer_clear()/timer_restore(), and the milliseconds they are offset by.
+// This function must be called from within a system lock zone.
+static inline uint32_t get_elapsed_ticks(uint32_t *ms_offset_out) {
     uint32_t ticks = get_system_time_ticks() - ticks_offset;
     if (ticks < last_ticks) {
         // The 32-bit tick counter overflowed and wrapped around.  We cannot just extend the counter to 64 bits here,
@@ -112,13 +113,30 @@ uint32_t timer_read32(void) {
         ticks_offset += OVERFLOW_ADJUST_TICKS;
         ms_offset += OVERFLOW_ADJUST_MS;
     }
-    last_ticks              = ticks;
-    uint32_t ms_offset_copy = ms_offset; // read while still holding the lock to ensure a consistent value
+    last_ticks     = ticks;
+    *ms_offset_out = ms_offset;
+    return ticks;
+}
+
+uint32_t timer_read32(void) {
+    uint32_t ms_offset_copy;
+    chSysLock();
+    uint32_t ticks = get_elapsed_ticks(&ms_offset_copy); // read while holding the lock to ensure consistent values
     chSysUnlock();
 
     return (uint32_t)TIME_I2MS(ticks) + ms_offset_copy;
 }
 
+uint32_t timer_read_us(void) {
+    uint32_t ms_offset_copy;
+    chSysLock();
+    uint32_t ticks = get_elapsed_ticks(&ms_offset_copy);
+    chSysUnlock();
+
+    // both parts are truncated to 32 bits, so the sum wraps around consistently at 2^32 us
+    return (uint32_t)TIME_I2US(ticks) + ms_offset_copy * 1000;
+}
+
 uint16_t timer_elapsed(uint16_t last) {
     return TIMER_DIFF_16(timer_read(), last);
 }
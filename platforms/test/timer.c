@@ -18,6 +18,7 @@
 #include <stdatomic.h>
 
 static atomic_uint_least32_t current_time      = 0;
+static atomic_uint_least32_t current_time_us   = 0; // sub-millisecond part of the current time, 0-999
 static atomic_uint_least32_t async_tick_amount = 0;
 static atomic_uint_least32_t access_counter    = 0;
 
@@ -39,12 +40,14 @@ void reset_access_counter(void) {
 
 void timer_init(void) {
     current_time      = 0;
+    current_time_us   = 0;
     async_tick_amount = 0;
     access_counter    = 0;
 }
 
 void timer_clear(void) {
     current_time      = 0;
+    current_time_us   = 0;
     async_tick_amount = 0;
     access_counter    = 0;
 }
@@ -60,6 +63,10 @@ uint32_t timer_read32(void) {
     return current_time;
 }
 
+uint32_t timer_read_us(void) {
+    return timer_read32() * 1000 + current_time_us;
+}
+
 uint16_t timer_elapsed(uint16_t last) {
     return TIMER_DIFF_16(timer_read(), last);
 }
@@ -69,8 +76,9 @@ uint32_t timer_elapsed32(uint32_t last) {
 }
 
 void set_time(uint32_t t) {
-    current_time   = t;
-    access_counter = 0;
+    current_time    = t;
+    current_time_us = 0;
+    access_counter  = 0;
 }
 
 void advance_time(uint32_t ms) {
@@ -78,6 +86,13 @@ void advance_time(uint32_t ms) {
     access_counter = 0;
 }
 
+void advance_time_us(uint32_t us) {
+    us += current_time_us;
+    current_time += us / 1000;
+    current_time_us = us % 1000;
+    access_counter  = 0;
+}
+
 void wait_ms(uint32_t ms) {
     advance_time(ms);
 }
@@ -6,3 +6,11 @@
 // Generate out-of-line copies for inline functions defined in timer.h.
 extern inline fast_timer_t timer_read_fast(void);
 extern inline fast_timer_t timer_elapsed_fast(fast_timer_t last);
+
+__attribute__((weak)) uint32_t timer_read_us(void) {
+    return timer_read32() * 1000;
+}
+
+uint32_t timer_elapsed_us(uint32_t last) {
+    return TIMER_DIFF_32(timer_read_us(), last);
+}
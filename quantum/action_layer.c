@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -316,16 +317,15 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
-/** \brief Layer switch get layer
+#ifndef NO_ACTION_LAYER
+/** \brief Resolve layer
  *
- * Gets the layer based on key info
+ * Finds the topmost non-transparent layer for a key within the given layer state
  */
-uint8_t layer_switch_get_layer(keypos_t key) {
-#ifndef NO_ACTION_LAYER
+static uint8_t resolve_layer(keypos_t key, layer_state_t layers) {
     action_t action;
     action.code = ACTION_TRANSPARENT;
 
-    layer_state_t layers = layer_state | default_layer_state;
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
@@ -337,6 +337,56 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     }
     /* fall back to layer 0 */
     return 0;
+}
+#endif
+
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE)
+/** \brief resolved layers cache
+ *
+ * Layer each matrix position resolved to for resolved_layers_state, or
+ * RESOLVED_LAYER_UNKNOWN if it hasn't been looked up since the last change.
+ */
+#    define RESOLVED_LAYER_UNKNOWN UINT8_MAX
+
+static uint8_t       resolved_layers_cache[MATRIX_ROWS][MATRIX_COLS];
+static layer_state_t resolved_layers_state;
+static bool          resolved_layers_valid = false;
+
+/** \brief Layer resolution cache clear
+ *
+ * Forgets all resolved layers, must be called whenever the keymap changes.
+ * Layer state changes are picked up automatically.
+ */
+void layer_resolution_cache_clear(void) {
+    resolved_layers_valid = false;
+}
+#endif
+
+/** \brief Layer switch get layer
+ *
+ * Gets the layer based on key info
+ */
+uint8_t layer_switch_get_layer(keypos_t key) {
+#ifndef NO_ACTION_LAYER
+    layer_state_t layers = layer_state | default_layer_state;
+
+#    ifdef LAYER_RESOLUTION_CACHE
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        if (!resolved_layers_valid || resolved_layers_state != layers) {
+            memset(resolved_layers_cache, RESOLVED_LAYER_UNKNOWN, sizeof(resolved_layers_cache));
+            resolved_layers_state = layers;
+            resolved_layers_valid = true;
+        }
+
+        uint8_t *resolved = &resolved_layers_cache[key.row][key.col];
+        if (*resolved == RESOLVED_LAYER_UNKNOWN) {
+            *resolved = resolve_layer(key, layers);
+        }
+        return *resolved;
+    }
+#    endif
+
+    return resolve_layer(key, layers);
 #else
     return get_highest_layer(default_layer_state);
 #endif
@@ -163,6 +163,13 @@ uint8_t read_source_layers_cache(keypos_t key);
 #endif
 action_t store_or_get_action(bool pressed, keypos_t key);
 
+/* resolved layers cache */
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE)
+void layer_resolution_cache_clear(void);
+#else
+#    define layer_resolution_cache_clear()
+#endif
+
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
@@ -20,8 +20,8 @@
 #    else
 #        define IS_TAPPING_RECORD(r) (KEYEQ(tapping_key.event.key, (r->event.key)) && tapping_key.keycode == r->keycode)
 #    endif
-#    define WITHIN_TAPPING_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
-#    define WITHIN_QUICK_TAP_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < GET_QUICK_TAP_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
+#    define WITHIN_TAPPING_TERM(e) KEYEVENT_WITHIN_TERM(e, tapping_key.event, GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
+#    define WITHIN_QUICK_TAP_TERM(e) KEYEVENT_WITHIN_TERM(e, tapping_key.event, GET_QUICK_TAP_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
 
 #    ifdef DYNAMIC_TAPPING_TERM_ENABLE
 uint16_t g_tapping_term = TAPPING_TERM;
@@ -129,7 +129,7 @@ void action_tapping_process(keyrecord_t record) {
  *     to RETRO_SHIFT if RETRO_SHIFT is set
  * for possibly retro shifted keys.
  */
-#        define MAYBE_RETRO_SHIFTING(ev, keyp) (get_auto_shifted_key(tapping_keycode, keyp) && TAP_GET_RETRO_TAPPING(keyp) && ((RETRO_SHIFT + 0) == 0 || TIMER_DIFF_16((ev).time, tapping_key.event.time) < (RETRO_SHIFT + 0)))
+#        define MAYBE_RETRO_SHIFTING(ev, keyp) (get_auto_shifted_key(tapping_keycode, keyp) && TAP_GET_RETRO_TAPPING(keyp) && ((RETRO_SHIFT + 0) == 0 || KEYEVENT_WITHIN_TERM(ev, tapping_key.event, RETRO_SHIFT + 0)))
 #        define TAP_IS_LT IS_QK_LAYER_TAP(tapping_keycode)
 #        define TAP_IS_MT IS_QK_MOD_TAP(tapping_keycode)
 #        define TAP_IS_RETRO IS_RETRO(tapping_keycode)
@@ -309,6 +309,9 @@ bool process_tapping(keyrecord_t *keyp) {
                             .event.time    = event.time,
                             .event.pressed = false,
                             .event.type    = tapping_key.event.type,
+#    ifdef KEYEVENT_TIME_US
+                            .event.time_us = event.time_us,
+#    endif
 #    ifdef COMBO_ENABLE
                             .keycode = tapping_key.keycode,
 #    endif
@@ -360,6 +363,9 @@ bool process_tapping(keyrecord_t *keyp) {
                             .event.time    = event.time,
                             .event.pressed = false,
                             .event.type    = tapping_key.event.type,
+#    ifdef KEYEVENT_TIME_US
+                            .event.time_us = event.time_us,
+#    endif
 #    ifdef COMBO_ENABLE
                             .keycode = tapping_key.keycode,
 #    endif
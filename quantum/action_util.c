@@ -290,23 +290,36 @@ void send_6kro_report(void) {
     host_keyboard_send(keyboard_report);
 #else
     static report_keyboard_t last_report;
+    static uint16_t          last_generation = 0;
+    uint16_t                 generation      = get_report_keys_generation();
 
-    /* Only send the report if there are changes to propagate to the host. */
-    if (memcmp(keyboard_report, &last_report, sizeof(report_keyboard_t)) != 0) {
+    /* Only send the report if there are changes to propagate to the host. The keys are only compared if they have been touched. */
+    if (keyboard_report->mods != last_report.mods || (generation != last_generation && memcmp(keyboard_report->keys, last_report.keys, sizeof(last_report.keys)) != 0)) {
         memcpy(&last_report, keyboard_report, sizeof(report_keyboard_t));
         host_keyboard_send(keyboard_report);
     }
+    last_generation = generation;
 #endif
 }
 
 #ifdef NKRO_ENABLE
 void send_nkro_report(void) {
+    static report_nkro_t last_report;
+    static uint16_t      last_generation = 0;
+    uint16_t             generation      = get_report_keys_generation();
+
     nkro_report->mods = get_mods_for_report();
 
-    static report_nkro_t last_report;
+    /* Only rebuild and compare the keys if they have been touched since the last report. */
+    bool changed = nkro_report->mods != last_report.mods;
+    if (generation != last_generation) {
+        keys_to_nkro_report(nkro_report);
+        changed |= memcmp(nkro_report->bits, last_report.bits, sizeof(last_report.bits)) != 0;
+        last_generation = generation;
+    }
 
     /* Only send the report if there are changes to propagate to the host. */
-    if (memcmp(nkro_report, &last_report, sizeof(report_nkro_t)) != 0) {
+    if (changed) {
         memcpy(&last_report, nkro_report, sizeof(report_nkro_t));
         host_nkro_send(nkro_report);
     }
@@ -74,6 +74,10 @@
 #ifndef AUDIO_TONE_STACKSIZE
 #    define AUDIO_TONE_STACKSIZE 8
 #endif
+// marks an empty slot on the stack; no valid (positive or zero=rest) frequency matches it
+#define TONE_PITCH_UNUSED UINT32_MAX
+#define TONE_UNUSED ((musical_tone_t){.time_started = 0, .pitch = TONE_PITCH_UNUSED, .duration = 0})
+
 uint8_t        active_tones = 0;            // number of tones pushed onto the stack by audio_play_tone - might be more than the hardware is able to reproduce at any single time
 musical_tone_t tones[AUDIO_TONE_STACKSIZE]; // stack of currently active tones
 
@@ -171,7 +175,7 @@ void audio_init(void) {
     }
 
     for (uint8_t i = 0; i < AUDIO_TONE_STACKSIZE; i++) {
-        tones[i] = (musical_tone_t){.time_started = 0, .pitch = -1.0f, .duration = 0};
+        tones[i] = TONE_UNUSED;
     }
 
     audio_driver_initialize();
@@ -239,17 +243,17 @@ void audio_stop_all(void) {
     melody_current_note_duration = 0;
 
     for (uint8_t i = 0; i < AUDIO_TONE_STACKSIZE; i++) {
-        tones[i] = (musical_tone_t){.time_started = 0, .pitch = -1.0f, .duration = 0};
+        tones[i] = TONE_UNUSED;
     }
 
     audio_driver_stopped = true;
 }
 
 void audio_stop_tone(float pitch) {
-    if (pitch < 0.0f) {
-        pitch = -1 * pitch;
-    }
+    audio_stop_tone_fixed(audio_freq_from_float(pitch));
+}
 
+void audio_stop_tone_fixed(audio_freq_t pitch) {
     if (playing_note) {
         if (!audio_initialized) {
             audio_init();
@@ -258,10 +262,10 @@ void audio_stop_tone(float pitch) {
         for (int i = AUDIO_TONE_STACKSIZE - 1; i >= 0; i--) {
             found = (tones[i].pitch == pitch);
             if (found) {
-                tones[i] = (musical_tone_t){.time_started = 0, .pitch = -1.0f, .duration = 0};
+                tones[i] = TONE_UNUSED;
                 for (int j = i; (j < AUDIO_TONE_STACKSIZE - 1); j++) {
                     tones[j]     = tones[j + 1];
-                    tones[j + 1] = (musical_tone_t){.time_started = 0, .pitch = -1.0f, .duration = 0};
+                    tones[j + 1] = TONE_UNUSED;
                 }
                 break;
             }
@@ -287,6 +291,10 @@ void audio_stop_tone(float pitch) {
 }
 
 void audio_play_note(float pitch, uint16_t duration) {
+    audio_play_note_fixed(audio_freq_from_float(pitch), duration);
+}
+
+void audio_play_note_fixed(audio_freq_t pitch, uint16_t duration) {
     if (!audio_config.enable) {
         return;
     }
@@ -295,10 +303,6 @@ void audio_play_note(float pitch, uint16_t duration) {
         audio_init();
     }
 
-    if (pitch < 0.0f) {
-        pitch = -1 * pitch;
-    }
-
     // round-robin: shifting out old tones, keeping only unique ones
     // if the new frequency is already amongst the active tones, shift it to the top of the stack
     bool found = false;
@@ -339,6 +343,10 @@ void audio_play_tone(float pitch) {
     audio_play_note(pitch, 0xffff);
 }
 
+void audio_play_tone_fixed(audio_freq_t pitch) {
+    audio_play_note_fixed(pitch, 0xffff);
+}
+
 void audio_play_melody(float (*np)[][2], uint16_t n_count, bool n_repeat) {
     if (!audio_config.enable) {
         audio_stop_all();
@@ -377,7 +385,7 @@ void  audio_play_click(uint16_t delay, float pitch, uint16_t duration) {
     uint16_t duration_tone  = audio_ms_to_duration(duration);
     uint16_t duration_delay = audio_ms_to_duration(delay);
 
-    if (delay <= 0.0f) {
+    if (delay == 0) {
         click[0][0] = pitch;
         click[0][1] = duration_tone;
         click[1][0] = 0.0f;
@@ -407,15 +415,23 @@ uint8_t audio_get_number_of_active_tones(void) {
 }
 
 float audio_get_frequency(uint8_t tone_index) {
+    return audio_freq_to_float(audio_get_frequency_fixed(tone_index));
+}
+
+audio_freq_t audio_get_frequency_fixed(uint8_t tone_index) {
     if (tone_index >= active_tones) {
-        return 0.0f;
+        return 0;
     }
     return tones[active_tones - tone_index - 1].pitch;
 }
 
 float audio_get_processed_frequency(uint8_t tone_index) {
+    return audio_freq_to_float(audio_get_processed_frequency_fixed(tone_index));
+}
+
+audio_freq_t audio_get_processed_frequency_fixed(uint8_t tone_index) {
     if (tone_index >= active_tones) {
-        return 0.0f;
+        return 0;
     }
 
     int8_t index = active_tones - tone_index - 1;
@@ -427,11 +443,11 @@ float audio_get_processed_frequency(uint8_t tone_index) {
         index += active_tones;
 #endif
 
-    if (tones[index].pitch <= 0.0f) {
-        return 0.0f;
+    if (tones[index].pitch == 0 || tones[index].pitch == TONE_PITCH_UNUSED) {
+        return 0;
     }
 
-    return voice_envelope(tones[index].pitch);
+    return voice_envelope_fixed(tones[index].pitch);
 }
 
 bool audio_update_state(void) {
@@ -465,7 +481,7 @@ bool audio_update_state(void) {
 
                 // special handling for successive notes of the same frequency:
                 // insert a short pause to separate them audibly
-                audio_play_note(0.0f, audio_duration_to_ms(2));
+                audio_play_note_fixed(0, audio_duration_to_ms(2));
                 current_note                 = previous_note;
                 melody_current_note_duration = audio_duration_to_ms(2);
 
@@ -523,7 +539,7 @@ bool audio_update_state(void) {
                 && (tones[i].duration != 0)   // 'uninitialized'
             ) {
                 if (timer_elapsed(tones[i].time_started) >= tones[i].duration) {
-                    audio_stop_tone(tones[i].pitch); // also sets 'state_changed=true'
+                    audio_stop_tone_fixed(tones[i].pitch); // also sets 'state_changed=true'
                 }
             }
         }
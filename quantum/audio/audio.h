@@ -18,6 +18,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "audio_freq.h"
 #include "musical_notes.h"
 #include "song_list.h"
 #include "voices.h"
@@ -46,11 +47,11 @@ _Static_assert(sizeof(audio_config_t) == sizeof(uint8_t), "Audio EECONFIG out of
  * "A musical tone is characterized by its duration, pitch, intensity (or loudness), and timbre (or quality)"
  */
 typedef struct {
-    uint16_t time_started; // timestamp the tone/note was started, system time runs with 1ms resolution -> 16bit timer overflows every ~64 seconds, long enough under normal circumstances; but might be too soon for long-duration notes when the note_tempo is set to a very low value
-    float    pitch;        // aka frequency, in Hz
-    uint16_t duration;     // in ms, converted from the musical_notes.h unit which has 64parts to a beat, factoring in the current tempo in beats-per-minute
-    // float intensity;    // aka volume [0,1] TODO: not used at the moment; pwm drivers can't handle it
-    // uint8_t timbre;     // range: [0,100] TODO: this currently kept track of globally, should we do this per tone instead?
+    uint16_t     time_started; // timestamp the tone/note was started, system time runs with 1ms resolution -> 16bit timer overflows every ~64 seconds, long enough under normal circumstances; but might be too soon for long-duration notes when the note_tempo is set to a very low value
+    audio_freq_t pitch;        // aka frequency, in Hz as Q16.16
+    uint16_t     duration;     // in ms, converted from the musical_notes.h unit which has 64parts to a beat, factoring in the current tempo in beats-per-minute
+    // float intensity;        // aka volume [0,1] TODO: not used at the moment; pwm drivers can't handle it
+    // uint8_t timbre;         // range: [0,100] TODO: this currently kept track of globally, should we do this per tone instead?
 } musical_tone_t;
 
 // public interface
@@ -97,6 +98,10 @@ bool audio_is_on(void);
  *                     from the musical_notes.h unit to ms
  */
 void audio_play_note(float pitch, uint16_t duration);
+/**
+ * @brief fixed-point variant of 'audio_play_note', taking a Q16.16 frequency
+ */
+void audio_play_note_fixed(audio_freq_t pitch, uint16_t duration);
 // TODO: audio_play_note(float pitch, uint16_t duration, float intensity, float timbre);
 // audio_play_note_with_instrument ifdef AUDIO_ENABLE_VOICES
 
@@ -114,6 +119,7 @@ void audio_play_note(float pitch, uint16_t duration);
  * @param[in] pitch frequency of the tone be played
  */
 void audio_play_tone(float pitch);
+void audio_play_tone_fixed(audio_freq_t pitch);
 
 /**
  * @brief stop a given tone/frequency
@@ -126,6 +132,7 @@ void audio_play_tone(float pitch);
  * @param[in] pitch tone/frequency to be stopped
  */
 void audio_stop_tone(float pitch);
+void audio_stop_tone_fixed(audio_freq_t pitch);
 
 /**
  * @brief play a melody
@@ -235,7 +242,8 @@ uint8_t audio_get_number_of_active_tones(void);
  *            older one
  * @return a positive frequency, in Hz; or zero if the tone is a pause
  */
-float audio_get_frequency(uint8_t tone_index);
+float        audio_get_frequency(uint8_t tone_index);
+audio_freq_t audio_get_frequency_fixed(uint8_t tone_index);
 
 /**
  * @brief calculate and return the frequency for the requested tone
@@ -248,6 +256,11 @@ float audio_get_frequency(uint8_t tone_index);
  * @return a positive frequency, in Hz; or zero if the tone is a pause
  */
 float audio_get_processed_frequency(uint8_t tone_index);
+/**
+ * @brief fixed-point variant of 'audio_get_processed_frequency', which drivers
+ *        should prefer; returns a Q16.16 frequency in Hz
+ */
+audio_freq_t audio_get_processed_frequency_fixed(uint8_t tone_index);
 
 /**
  * @brief   update audio internal state: currently playing and active tones,...
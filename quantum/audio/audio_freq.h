@@ -0,0 +1,29 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * frequencies are kept track of as unsigned Q16.16 fixed-point values in Hz, so that MCUs
+ * without an FPU don't end up doing soft-float math on every state update or sample;
+ * SONG arrays and the float based functions in audio.h are converted once, when a note starts
+ */
+typedef uint32_t audio_freq_t;
+
+#define AUDIO_FREQ_FRACTION_BITS 16
+#define AUDIO_FREQ_ONE ((audio_freq_t)1 << AUDIO_FREQ_FRACTION_BITS)
+// for compile-time constants; use audio_freq_from_float at runtime
+#define AUDIO_FREQ_FROM_HZ(hz) ((audio_freq_t)((hz) * (float)AUDIO_FREQ_ONE + 0.5f))
+#define AUDIO_FREQ_TO_HZ(freq) ((freq) >> AUDIO_FREQ_FRACTION_BITS)
+
+static inline audio_freq_t audio_freq_from_float(float pitch) {
+    if (pitch < 0.0f) {
+        pitch = -pitch;
+    }
+    return (audio_freq_t)(pitch * (float)AUDIO_FREQ_ONE + 0.5f);
+}
+
+static inline float audio_freq_to_float(audio_freq_t freq) {
+    return (float)freq / (float)AUDIO_FREQ_ONE;
+}
@@ -24,4 +24,5 @@
 #define FREQUENCY_LUT_LENGTH 349
 
 extern const float    vibrato_lut[VIBRATO_LUT_LENGTH];
+extern const int16_t  vibrato_offset_lut[VIBRATO_LUT_LENGTH];
 extern const uint16_t frequency_lut[FREQUENCY_LUT_LENGTH];
@@ -20,11 +20,23 @@
 #include <stdlib.h>
 #include <math.h>
 
+#define VIBRATO_STRENGTH_DEFAULT 0.5f
+#define VIBRATO_RATE_DEFAULT 0.125f
+
+// strength as Q16.16 exponent, applied to the vibrato_offset_lut
+#define VIBRATO_STRENGTH_FIXED(strength) ((uint32_t)((strength) * 65536.0f + 0.5f))
+// rate as Q16.16 steps through the vibrato lut per ms
+#define VIBRATO_STEP_FIXED(rate) ((uint32_t)(65536.0f / (100.0f * (rate)) + 0.5f))
+
 uint8_t note_timbre      = TIMBRE_DEFAULT;
 bool    glissando        = false;
 bool    vibrato          = false;
-float   vibrato_strength = 0.5;
-float   vibrato_rate     = 0.125;
+float   vibrato_strength = VIBRATO_STRENGTH_DEFAULT;
+float   vibrato_rate     = VIBRATO_RATE_DEFAULT;
+
+// fixed-point copies of the above, only updated by the (rarely called) setters
+static uint32_t vibrato_strength_fixed = VIBRATO_STRENGTH_FIXED(VIBRATO_STRENGTH_DEFAULT);
+static uint32_t vibrato_step_fixed     = VIBRATO_STEP_FIXED(VIBRATO_RATE_DEFAULT);
 
 uint16_t voices_timer = 0;
 
@@ -47,16 +59,20 @@ void voice_deiterate(void) {
 }
 
 #ifdef AUDIO_VOICES
-float mod(float a, int b) {
-    float r = fmod(a, b);
-    return r < 0 ? r + b : r;
+// scales the frequency by (1 + offset), with the offset in Q16.16
+static audio_freq_t voice_offset_frequency(audio_freq_t frequency, int32_t offset) {
+    return frequency + (int32_t)(((int64_t)frequency * offset) >> 16);
 }
 
 // Effect: 'vibrate' a given target frequency slightly above/below its initial value
-float voice_add_vibrato(float average_freq) {
-    float vibrato_counter = mod(timer_read() / (100 * vibrato_rate), VIBRATO_LUT_LENGTH);
+audio_freq_t voice_add_vibrato(audio_freq_t average_freq) {
+    uint8_t vibrato_counter = (uint32_t)(((uint64_t)timer_read() * vibrato_step_fixed) >> 16) % VIBRATO_LUT_LENGTH;
 
-    return average_freq * pow(vibrato_lut[(int)vibrato_counter], vibrato_strength);
+    // the lut only deviates from 1.0 by less than a percent, where lut^strength is
+    // indistinguishable from 1 + strength * (lut - 1)
+    int32_t offset = ((int64_t)vibrato_offset_lut[vibrato_counter] * vibrato_strength_fixed) / 65536;
+
+    return voice_offset_frequency(average_freq, offset);
 }
 
 // Effect: 'slides' the 'frequency' from the starting-point, to the target frequency
@@ -72,6 +88,10 @@ float voice_add_glissando(float from_freq, float to_freq) {
 #endif
 
 float voice_envelope(float frequency) {
+    return audio_freq_to_float(voice_envelope_fixed(audio_freq_from_float(frequency)));
+}
+
+audio_freq_t voice_envelope_fixed(audio_freq_t frequency) {
     // envelope_index ranges from 0 to 0xFFFF, which is preserved at 880.0 Hz
 //    __attribute__((unused)) uint16_t compensated_index = (uint16_t)((float)envelope_index * (880.0 / frequency));
 #ifdef AUDIO_VOICES
@@ -128,10 +148,10 @@ float voice_envelope(float frequency) {
             // }
             // frequency = (rand() % (int)(frequency * 1.2 - frequency)) + (frequency * 0.8);
 
-            if (frequency < 80.0) {
-            } else if (frequency < 160.0) {
+            if (frequency < AUDIO_FREQ_FROM_HZ(80)) {
+            } else if (frequency < AUDIO_FREQ_FROM_HZ(160)) {
                 // Bass drum: 60 - 100 Hz
-                frequency = (rand() % (int)(40)) + 60;
+                frequency = (audio_freq_t)((rand() % 40) + 60) << AUDIO_FREQ_FRACTION_BITS;
                 switch (envelope_index) {
                     case 0 ... 10:
                         note_timbre = 50;
@@ -144,9 +164,9 @@ float voice_envelope(float frequency) {
                         break;
                 }
 
-            } else if (frequency < 320.0) {
+            } else if (frequency < AUDIO_FREQ_FROM_HZ(320)) {
                 // Snare drum: 1 - 2 KHz
-                frequency = (rand() % (int)(1000)) + 1000;
+                frequency = (audio_freq_t)((rand() % 1000) + 1000) << AUDIO_FREQ_FRACTION_BITS;
                 switch (envelope_index) {
                     case 0 ... 5:
                         note_timbre = 50;
@@ -159,9 +179,9 @@ float voice_envelope(float frequency) {
                         break;
                 }
 
-            } else if (frequency < 640.0) {
+            } else if (frequency < AUDIO_FREQ_FROM_HZ(640)) {
                 // Closed Hi-hat: 3 - 5 KHz
-                frequency = (rand() % (int)(2000)) + 3000;
+                frequency = (audio_freq_t)((rand() % 2000) + 3000) << AUDIO_FREQ_FRACTION_BITS;
                 switch (envelope_index) {
                     case 0 ... 15:
                         note_timbre = 50;
@@ -174,9 +194,9 @@ float voice_envelope(float frequency) {
                         break;
                 }
 
-            } else if (frequency < 1280.0) {
+            } else if (frequency < AUDIO_FREQ_FROM_HZ(1280)) {
                 // Open Hi-hat: 3 - 5 KHz
-                frequency = (rand() % (int)(2000)) + 3000;
+                frequency = (audio_freq_t)((rand() % 2000) + 3000) << AUDIO_FREQ_FRACTION_BITS;
                 switch (envelope_index) {
                     case 0 ... 35:
                         note_timbre = 50;
@@ -204,7 +224,8 @@ float voice_envelope(float frequency) {
                     break;
 
                 case 20 ... 200:
-                    note_timbre = 12 - (uint8_t)(pow(((float)compensated_index - 20) / (200 - 20), 2) * 12.5);
+                    // 12 - ((index - 20) / (200 - 20))^2 * 12.5
+                    note_timbre = 12 - (uint8_t)((uint32_t)(compensated_index - 20) * (compensated_index - 20) * 25 / (2 * (200 - 20) * (200 - 20)));
                     break;
 
                 default:
@@ -241,18 +262,18 @@ float voice_envelope(float frequency) {
             switch (compensated_index) {
                 default:
 #    define OCS_SPEED 10
-#    define OCS_AMP .25
+#    define OCS_AMP 25 // in percent
                     // sine wave is slow
                     // note_timbre = (sin((float)compensated_index/10000*OCS_SPEED) * OCS_AMP / 2) + .5;
                     // triangle wave is a bit faster
-                    note_timbre = (uint8_t)abs((compensated_index * OCS_SPEED % 3000) - 1500) * (OCS_AMP / 1500) + (1 - OCS_AMP) / 2;
+                    note_timbre = (abs((compensated_index * OCS_SPEED % 3000) - 1500) * OCS_AMP / 100 + 1500 * (100 - OCS_AMP) / 200) / 1500;
                     break;
             }
             break;
 
         case duty_octave_down:
             glissando   = true;
-            note_timbre = (uint8_t)(100 * (envelope_index % 2) * .125 + .375 * 2);
+            note_timbre = (uint8_t)((100 * (envelope_index % 2) + 6) / 8); // 100 * (index % 2) * .125 + .375 * 2
             if ((envelope_index % 4) == 0) note_timbre = 50;
             if ((envelope_index % 8) == 0) note_timbre = 0;
             break;
@@ -266,7 +287,7 @@ float voice_envelope(float frequency) {
                     break;
                 default:
                     // TODO: merge/replace with voice_add_vibrato above
-                    frequency = frequency * vibrato_lut[(int)fmod((((float)compensated_index - (VOICE_VIBRATO_DELAY + 1)) / 1000 * VOICE_VIBRATO_SPEED), VIBRATO_LUT_LENGTH)];
+                    frequency = voice_offset_frequency(frequency, vibrato_offset_lut[(compensated_index - (VOICE_VIBRATO_DELAY + 1)) * VOICE_VIBRATO_SPEED / 1000 % VIBRATO_LUT_LENGTH]);
                     break;
             }
             break;
@@ -318,7 +339,7 @@ float voice_envelope(float frequency) {
     }
 
 #ifdef AUDIO_VOICES
-    if (vibrato && (vibrato_strength > 0)) {
+    if (vibrato && (vibrato_strength_fixed > 0)) {
         frequency = voice_add_vibrato(frequency);
     }
 
@@ -334,22 +355,24 @@ float voice_envelope(float frequency) {
 // Vibrato functions
 
 void voice_set_vibrato_rate(float rate) {
-    vibrato_rate = rate;
+    vibrato_rate       = rate;
+    vibrato_step_fixed = (rate > 0.0f) ? VIBRATO_STEP_FIXED(rate) : 0;
 }
 void voice_increase_vibrato_rate(float change) {
-    vibrato_rate *= change;
+    voice_set_vibrato_rate(vibrato_rate * change);
 }
 void voice_decrease_vibrato_rate(float change) {
-    vibrato_rate /= change;
+    voice_set_vibrato_rate(vibrato_rate / change);
 }
 void voice_set_vibrato_strength(float strength) {
-    vibrato_strength = strength;
+    vibrato_strength       = strength;
+    vibrato_strength_fixed = (strength > 0.0f) ? VIBRATO_STRENGTH_FIXED(strength) : 0;
 }
 void voice_increase_vibrato_strength(float change) {
-    vibrato_strength *= change;
+    voice_set_vibrato_strength(vibrato_strength * change);
 }
 void voice_decrease_vibrato_strength(float change) {
-    vibrato_strength /= change;
+    voice_set_vibrato_strength(vibrato_strength / change);
 }
 
 // Timbre functions
@@ -20,8 +20,10 @@
 #include <stdbool.h>
 #include "wait.h"
 #include "luts.h"
+#include "audio_freq.h"
 
-float voice_envelope(float frequency);
+float        voice_envelope(float frequency);
+audio_freq_t voice_envelope_fixed(audio_freq_t frequency);
 
 typedef enum {
     default_voice,
@@ -0,0 +1,134 @@
+/*
+Copyright 2026 QMK
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Symmetric per-key algorithm using vertical counters, behaves like sym_eager_pk.
+Each row's counters are stored as bit-planes: bit N of every key's counter lives
+in one matrix_row_t, so a whole row is updated with a handful of bitwise ops.
+After pressing a key, it immediately changes state, and sets a counter.
+No further inputs are accepted until DEBOUNCE milliseconds have occurred.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+#include <stdlib.h>
+
+#ifdef PROTOCOL_CHIBIOS
+#    if CH_CFG_USE_MEMCORE == FALSE
+#        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
+#    endif
+#endif
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#include "vertical_counter.h"
+
+#if DEBOUNCE > 0
+static matrix_row_t *debounce_counters;
+static fast_timer_t  last_time;
+static bool          counters_need_update;
+static bool          matrix_need_update;
+static bool          cooked_changed;
+
+static void update_debounce_counters(uint8_t num_rows, uint8_t elapsed_time);
+static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    debounce_counters = (matrix_row_t *)calloc(num_rows * DEBOUNCE_COUNTER_BITS, sizeof(matrix_row_t));
+}
+
+void debounce_free(void) {
+    free(debounce_counters);
+    debounce_counters = NULL;
+}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters(num_rows, elapsed_time);
+        }
+    }
+
+    if (changed || matrix_need_update) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        transfer_matrix_values(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+// If the current time is > debounce counter, set the counter to enable input.
+static void update_debounce_counters(uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update  = false;
+    matrix_need_update    = false;
+    matrix_row_t *counter = debounce_counters;
+    for (uint8_t row = 0; row < num_rows; row++, counter += DEBOUNCE_COUNTER_BITS) {
+        matrix_row_t active = active_counters(counter);
+        if (!active) {
+            continue;
+        }
+
+        matrix_row_t expired = subtract_elapsed_time(counter, elapsed_time) & active;
+        if (expired) {
+            matrix_need_update = true;
+        }
+        if (active & ~expired) {
+            counters_need_update = true;
+        }
+    }
+}
+
+// upload from raw_matrix to final matrix;
+static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    matrix_need_update    = false;
+    matrix_row_t *counter = debounce_counters;
+    for (uint8_t row = 0; row < num_rows; row++, counter += DEBOUNCE_COUNTER_BITS) {
+        // Flip every changed key whose counter isn't running
+        matrix_row_t flip = (raw[row] ^ cooked[row]) & ~active_counters(counter);
+        if (flip) {
+            start_counters(counter, flip);
+            counters_need_update = true;
+            cooked[row] ^= flip;
+            cooked_changed = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
@@ -0,0 +1,87 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Vertical counter helpers shared by the sym_*_vc debounce algorithms.
+Bit N of every key's counter in a row lives in counter[N], so a row of counters
+is an array of DEBOUNCE_COUNTER_BITS matrix_row_t. DEBOUNCE must be defined
+(and clamped to UINT8_MAX) before this header is included.
+*/
+
+#pragma once
+
+#include "matrix.h"
+
+// Number of bit-planes needed to hold DEBOUNCE
+#if DEBOUNCE < 2
+#    define DEBOUNCE_COUNTER_BITS 1
+#elif DEBOUNCE < 4
+#    define DEBOUNCE_COUNTER_BITS 2
+#elif DEBOUNCE < 8
+#    define DEBOUNCE_COUNTER_BITS 3
+#elif DEBOUNCE < 16
+#    define DEBOUNCE_COUNTER_BITS 4
+#elif DEBOUNCE < 32
+#    define DEBOUNCE_COUNTER_BITS 5
+#elif DEBOUNCE < 64
+#    define DEBOUNCE_COUNTER_BITS 6
+#elif DEBOUNCE < 128
+#    define DEBOUNCE_COUNTER_BITS 7
+#else
+#    define DEBOUNCE_COUNTER_BITS 8
+#endif
+
+#define ROW_ALL_KEYS ((matrix_row_t)~(matrix_row_t)0)
+
+// Keys whose counter is running
+static inline matrix_row_t active_counters(const matrix_row_t counter[]) {
+    matrix_row_t active = 0;
+    for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+        active |= counter[bit];
+    }
+    return active;
+}
+
+// Subtracts elapsed_time from every counter in the row, returning the keys which reached zero
+static inline matrix_row_t subtract_elapsed_time(matrix_row_t counter[], uint8_t elapsed_time) {
+    matrix_row_t borrow    = 0;
+    matrix_row_t remaining = 0;
+
+    if (elapsed_time >= DEBOUNCE) {
+        borrow = ROW_ALL_KEYS;
+    } else {
+        // Ripple-borrow subtractor, one bit-plane at a time
+        for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+            matrix_row_t count   = counter[bit];
+            matrix_row_t elapsed = (elapsed_time & (1 << bit)) ? ROW_ALL_KEYS : 0;
+            matrix_row_t diff    = count ^ elapsed ^ borrow;
+            borrow               = (~count & (elapsed | borrow)) | (elapsed & borrow);
+            counter[bit]         = diff;
+            remaining |= diff;
+        }
+    }
+
+    matrix_row_t expired = borrow | ~remaining;
+    for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+        counter[bit] &= ~expired;
+    }
+    return expired;
+}
+
+// Sets the counters of the given keys to DEBOUNCE
+static inline void start_counters(matrix_row_t counter[], matrix_row_t keys) {
+    for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+        if (DEBOUNCE & (1 << bit)) {
+            counter[bit] |= keys;
+        } else {
+            counter[bit] &= ~keys;
+        }
+    }
+}
+
+// Stops the counters of the given keys
+static inline void stop_counters(matrix_row_t counter[], matrix_row_t keys) {
+    for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+        counter[bit] &= ~keys;
+    }
+}
@@ -39,6 +39,124 @@ static inline deferred_token allocate_token(deferred_executor_t *table, size_t t
     return current_token;
 }
 
+//------------------------------------
+// Scheduling helpers
+//
+// Each executor table is kept as a binary min-heap ordered by trigger time: the in-use entries occupy the front of the
+// table, and table[0] is always the next executor due. Checking whether anything needs to run is then a single
+// comparison, rather than a walk over every slot each millisecond.
+//
+
+static inline bool trigger_before(const deferred_executor_t *a, const deferred_executor_t *b) {
+    return ((int32_t)TIMER_DIFF_32(a->trigger_time, b->trigger_time)) < 0;
+}
+
+static inline void swap_entries(deferred_executor_t *table, size_t a, size_t b) {
+    deferred_executor_t tmp = table[a];
+    table[a]                = table[b];
+    table[b]                = tmp;
+}
+
+static inline void clear_entry(deferred_executor_t *entry) {
+    entry->token        = INVALID_DEFERRED_TOKEN;
+    entry->trigger_time = 0;
+    entry->callback     = NULL;
+    entry->cb_arg       = NULL;
+}
+
+static size_t heap_count(deferred_executor_t *table, size_t table_count) {
+    size_t count = 0;
+    while (count < table_count && table[count].token != INVALID_DEFERRED_TOKEN) {
+        ++count;
+    }
+    return count;
+}
+
+static size_t heap_find(deferred_executor_t *table, size_t count, deferred_token token) {
+    for (size_t i = 0; i < count; ++i) {
+        if (table[i].token == token) {
+            return i;
+        }
+    }
+    return count;
+}
+
+static size_t heap_sift_up(deferred_executor_t *table, size_t index) {
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!trigger_before(&table[index], &table[parent])) {
+            break;
+        }
+        swap_entries(table, index, parent);
+        index = parent;
+    }
+    return index;
+}
+
+static void heap_sift_down(deferred_executor_t *table, size_t count, size_t index) {
+    for (;;) {
+        size_t left     = 2 * index + 1;
+        size_t right    = left + 1;
+        size_t earliest = index;
+        if (left < count && trigger_before(&table[left], &table[earliest])) {
+            earliest = left;
+        }
+        if (right < count && trigger_before(&table[right], &table[earliest])) {
+            earliest = right;
+        }
+        if (earliest == index) {
+            break;
+        }
+        swap_entries(table, index, earliest);
+        index = earliest;
+    }
+}
+
+// Restores heap ordering after the trigger time of table[index] has changed
+static void heap_update(deferred_executor_t *table, size_t count, size_t index) {
+    heap_sift_down(table, count, heap_sift_up(table, index));
+}
+
+// Removes table[index], moving the last in-use entry into its place
+static void heap_remove(deferred_executor_t *table, size_t count, size_t index) {
+    size_t last = count - 1;
+    if (index != last) {
+        table[index] = table[last];
+        clear_entry(&table[last]);
+        heap_update(table, last, index);
+    } else {
+        clear_entry(&table[last]);
+    }
+}
+
+static inline bool trigger_due(const deferred_executor_t *entry, uint32_t now) {
+    return ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0;
+}
+
+static inline bool token_executed(const uint8_t *executed, deferred_token token) {
+    return executed[token / 8] & (1 << (token % 8));
+}
+
+// Finds the earliest executor that is due and hasn't already run in this pass, or count if there are none
+static size_t heap_next_due(deferred_executor_t *table, size_t count, uint32_t now, const uint8_t *executed) {
+    // The head is the earliest of them all, so usually nothing else needs checking
+    if (count == 0 || !trigger_due(&table[0], now)) {
+        return count;
+    }
+    if (!token_executed(executed, table[0].token)) {
+        return 0;
+    }
+
+    // The head is a repeating executor that has fallen behind, so look for the earliest of the others that are due
+    size_t next = count;
+    for (size_t i = 1; i < count; ++i) {
+        if (trigger_due(&table[i], now) && !token_executed(executed, table[i].token) && (next == count || trigger_before(&table[i], &table[next]))) {
+            next = i;
+        }
+    }
+    return next;
+}
+
 //------------------------------------
 // Advanced API: used when a custom-allocated table is used, primarily for core code.
 //
@@ -49,27 +167,27 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
+    // In-use entries are packed at the front of the table, so the first unused slot is directly after them
+    size_t count = heap_count(table, table_count);
+    if (count == table_count) {
+        // None available
+        return INVALID_DEFERRED_TOKEN;
+    }
 
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Work out the new token value, dropping out if none were available
+    deferred_token token = allocate_token(table, table_count);
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return INVALID_DEFERRED_TOKEN;
     }
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Set up the executor table entry, and move it into place
+    deferred_executor_t *entry = &table[count];
+    entry->token               = token;
+    entry->trigger_time        = timer_read32() + delay_ms;
+    entry->callback            = callback;
+    entry->cb_arg              = cb_arg;
+    heap_sift_up(table, count);
+    return token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
@@ -79,17 +197,17 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    size_t count = heap_count(table, table_count);
+    size_t index = heap_find(table, count, token);
+    if (index == count) {
+        // Not found
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    table[index].trigger_time = timer_read32() + delay_ms;
+    heap_update(table, count, index);
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -99,20 +217,25 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    size_t count = heap_count(table, table_count);
+    size_t index = heap_find(table, count, token);
+    if (index == count) {
+        // Not found
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    heap_remove(table, count, index);
+    return true;
+}
+
+uint32_t deferred_exec_advanced_time_until_next(deferred_executor_t *table, size_t table_count) {
+    if (!table || table_count == 0 || table[0].token == INVALID_DEFERRED_TOKEN) {
+        return DEFERRED_EXEC_IDLE;
+    }
+
+    int32_t remaining = (int32_t)TIMER_DIFF_32(table[0].trigger_time, timer_read32());
+    return remaining > 0 ? (uint32_t)remaining : 0;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
@@ -122,35 +245,41 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
-            deferred_token       curr_token = entry->token;
-
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
-
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
-
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
-                }
+        // Each executor runs at most once per pass, even if it has fallen behind and is still due after being requeued
+        uint8_t executed[(1 << (8 * sizeof(deferred_token))) / 8] = {0};
+
+        // Run through the executors that are due, earliest first
+        for (;;) {
+            size_t count = heap_count(table, table_count);
+            size_t index = heap_next_due(table, count, now, executed);
+            if (index == count) {
+                break;
+            }
+            deferred_token curr_token = table[index].token;
+            executed[curr_token / 8] |= 1 << (curr_token % 8);
+
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = table[index].callback(table[index].trigger_time, table[index].cb_arg);
+
+            // The callback may have added, extended, or cancelled executors, so find this one again. If it's gone, then
+            // the callback has canceled (and possibly re-queued under a new token). Skip further processing.
+            count = heap_count(table, table_count);
+            index = heap_find(table, count, curr_token);
+            if (index == count) {
+                continue;
+            }
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                table[index].trigger_time += delay_ms;
+                heap_update(table, count, index);
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                heap_remove(table, count, index);
             }
         }
     }
@@ -175,3 +304,6 @@ bool cancel_deferred_exec(deferred_token token) {
 void deferred_exec_task(void) {
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
 }
+uint32_t deferred_exec_time_until_next(void) {
+    return deferred_exec_advanced_time_until_next(basic_executors, MAX_DEFERRED_EXECUTORS);
+}
@@ -21,6 +21,11 @@ typedef uint8_t deferred_token;
  */
 #define INVALID_DEFERRED_TOKEN 0
 
+/**
+ * @def The value returned by the time-until-next functions when there are no deferred executions pending.
+ */
+#define DEFERRED_EXEC_IDLE UINT32_MAX
+
 /**
  * @typedef Callback to execute.
  * @param trigger_time[in] the intended trigger time to execute the callback -- equivalent time-space as timer_read32()
@@ -65,6 +70,13 @@ bool cancel_deferred_exec(deferred_token token);
  */
 void deferred_exec_task(void);
 
+/**
+ * Retrieves the time until the next deferred execution is due, allowing the main loop to skip the deferred execution task, or sleep.
+ *
+ * @return the number of milliseconds until the next deferred execution is due, 0 if one is already due, or DEFERRED_EXEC_IDLE if none are pending
+ */
+uint32_t deferred_exec_time_until_next(void);
+
 //------------------------------------
 // Advanced API: used when a custom-allocated table is used, primarily for core code.
 //------------------------------------
@@ -72,7 +84,8 @@ void deferred_exec_task(void);
 /**
  * @struct Structure for containing self-hosted deferred executor tables.
  * @brief Core-side code can use this to create their own tables without impacting on the use of users' ability to add deferred execution.
- *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in an array.
+ *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in a zero-initialised array.
+ *        The table is maintained as a min-heap ordered by trigger time, so entries must not be modified directly.
  */
 typedef struct deferred_executor_t {
     deferred_token         token;
@@ -119,3 +132,12 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  * @param last_execution_time[in,out] the last execution time -- this will be checked first to determine if execution is needed, and updated if execution occurred
  */
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time);
+
+/**
+ * Retrieves the time until the next deferred execution in a custom table is due.
+ *
+ * @param table[in] the custom table used for storage
+ * @param table_count[in] the number of available items in the table
+ * @return the number of milliseconds until the next deferred execution is due, 0 if one is already due, or DEFERRED_EXEC_IDLE if none are pending
+ */
+uint32_t deferred_exec_advanced_time_until_next(deferred_executor_t *table, size_t table_count);
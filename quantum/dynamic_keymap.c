@@ -14,13 +14,22 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "eeprom.h"
 #include "progmem.h"
 #include "send_string.h"
 #include "keycodes.h"
+#include "timer.h"
+#include "util.h"
+#include "wait.h"
+
+#ifdef EEPROM_DRIVER
+#    include "eeprom_driver.h"
+#endif
 
 #ifdef VIA_ENABLE
 #    include "via.h"
@@ -101,6 +110,83 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+#    ifndef DYNAMIC_KEYMAP_RAM_CACHE_WRITE_DELAY
+#        define DYNAMIC_KEYMAP_RAM_CACHE_WRITE_DELAY 1000
+#    endif
+
+// The RAM copy spans the keymaps, encoder maps and macros, which must be laid out in that order
+#    define DYNAMIC_KEYMAP_RAM_CACHE_SIZE ((DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR) + (DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) - (DYNAMIC_KEYMAP_EEPROM_ADDR))
+_Static_assert((DYNAMIC_KEYMAP_EEPROM_ADDR) <= (DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR) && (DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR) <= (DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR), "DYNAMIC_KEYMAP_RAM_CACHE requires the keymaps, encoder maps and macros to be stored in that order.");
+
+// Changes are tracked in chunks, each persisted with a single eeprom_update_block()
+#    define DYNAMIC_KEYMAP_RAM_CACHE_CHUNK_SIZE 16
+#    define DYNAMIC_KEYMAP_RAM_CACHE_CHUNK_COUNT (((DYNAMIC_KEYMAP_RAM_CACHE_SIZE) + (DYNAMIC_KEYMAP_RAM_CACHE_CHUNK_SIZE) - 1) / (DYNAMIC_KEYMAP_RAM_CACHE_CHUNK_SIZE))
+
+static uint8_t  dynamic_keymap_ram[DYNAMIC_KEYMAP_RAM_CACHE_SIZE];
+static uint8_t  dynamic_keymap_ram_dirty[((DYNAMIC_KEYMAP_RAM_CACHE_CHUNK_COUNT) + 7) / 8];
+static bool     dynamic_keymap_ram_loaded  = false;
+static bool     dynamic_keymap_ram_pending = false;
+static uint32_t dynamic_keymap_ram_last_write;
+
+// Loaded on first use rather than at init, so that resets performed while EEPROM is being initialised are not lost
+static uint8_t *dynamic_keymap_ram_data(void) {
+    if (!dynamic_keymap_ram_loaded) {
+        eeprom_read_block(dynamic_keymap_ram, (const void *)(DYNAMIC_KEYMAP_EEPROM_ADDR), sizeof(dynamic_keymap_ram));
+        dynamic_keymap_ram_loaded = true;
+    }
+    return dynamic_keymap_ram;
+}
+
+static uint8_t dynamic_keymap_read_byte(const void *address) {
+    return dynamic_keymap_ram_data()[(uintptr_t)address - (DYNAMIC_KEYMAP_EEPROM_ADDR)];
+}
+
+static void dynamic_keymap_update_byte(void *address, uint8_t value) {
+    uint16_t offset = (uintptr_t)address - (DYNAMIC_KEYMAP_EEPROM_ADDR);
+    uint16_t chunk  = offset / (DYNAMIC_KEYMAP_RAM_CACHE_CHUNK_SIZE);
+
+    dynamic_keymap_ram_data()[offset] = value;
+    // Marked even if unchanged, as the EEPROM may have been erased underneath the RAM copy
+    dynamic_keymap_ram_dirty[chunk / 8] |= 1 << (chunk % 8);
+
+    dynamic_keymap_ram_pending    = true;
+    dynamic_keymap_ram_last_write = timer_read32();
+}
+
+void dynamic_keymap_flush(void) {
+    if (!dynamic_keymap_ram_pending) {
+        return;
+    }
+
+#    ifdef EEPROM_DRIVER
+    eeprom_driver_batch_begin();
+#    endif
+    for (uint16_t chunk = 0; chunk < (DYNAMIC_KEYMAP_RAM_CACHE_CHUNK_COUNT); chunk++) {
+        if (dynamic_keymap_ram_dirty[chunk / 8] & (1 << (chunk % 8))) {
+            uint16_t offset = chunk * (DYNAMIC_KEYMAP_RAM_CACHE_CHUNK_SIZE);
+            uint16_t size   = MIN((DYNAMIC_KEYMAP_RAM_CACHE_CHUNK_SIZE), sizeof(dynamic_keymap_ram) - offset);
+            eeprom_update_block(&dynamic_keymap_ram[offset], (void *)(uintptr_t)((DYNAMIC_KEYMAP_EEPROM_ADDR) + offset), size);
+        }
+    }
+#    ifdef EEPROM_DRIVER
+    eeprom_driver_batch_end();
+#    endif
+
+    memset(dynamic_keymap_ram_dirty, 0, sizeof(dynamic_keymap_ram_dirty));
+    dynamic_keymap_ram_pending = false;
+}
+
+void dynamic_keymap_task(void) {
+    if (dynamic_keymap_ram_pending && timer_elapsed32(dynamic_keymap_ram_last_write) >= (DYNAMIC_KEYMAP_RAM_CACHE_WRITE_DELAY)) {
+        dynamic_keymap_flush();
+    }
+}
+#else
+#    define dynamic_keymap_read_byte(address) eeprom_read_byte(address)
+#    define dynamic_keymap_update_byte(address, value) eeprom_update_byte(address, value)
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -114,8 +200,8 @@ uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column)
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    uint16_t keycode = eeprom_read_byte(address) << 8;
-    keycode |= eeprom_read_byte(address + 1);
+    uint16_t keycode = dynamic_keymap_read_byte(address) << 8;
+    keycode |= dynamic_keymap_read_byte(address + 1);
     return keycode;
 }
 
@@ -123,8 +209,9 @@ void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address, (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+    dynamic_keymap_update_byte(address, (uint8_t)(keycode >> 8));
+    dynamic_keymap_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+    layer_resolution_cache_clear();
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -136,8 +223,8 @@ uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool cloc
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
-    keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
+    uint16_t keycode = ((uint16_t)dynamic_keymap_read_byte(address + (clockwise ? 0 : 2))) << 8;
+    keycode |= dynamic_keymap_read_byte(address + (clockwise ? 0 : 2) + 1);
     return keycode;
 }
 
@@ -145,12 +232,15 @@ void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwis
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+    dynamic_keymap_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
+    dynamic_keymap_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
 }
 #endif // ENCODER_MAP_ENABLE
 
 void dynamic_keymap_reset(void) {
+#ifdef EEPROM_DRIVER
+    eeprom_driver_batch_begin();
+#endif
     // Reset the keymaps in EEPROM to what is in flash.
     for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
         for (int row = 0; row < MATRIX_ROWS; row++) {
@@ -165,15 +255,22 @@ void dynamic_keymap_reset(void) {
         }
 #endif // ENCODER_MAP_ENABLE
     }
+#ifdef EEPROM_DRIVER
+    eeprom_driver_batch_end();
+#endif
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    // Written straight away, as VIA marks its EEPROM as valid as soon as this returns
+    dynamic_keymap_flush();
+#endif
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    void *   source                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *target                     = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
-            *target = eeprom_read_byte(source);
+            *target = dynamic_keymap_read_byte(source);
         } else {
             *target = 0x00;
         }
@@ -184,15 +281,22 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    void *   target                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *source                     = data;
+#ifdef EEPROM_DRIVER
+    eeprom_driver_batch_begin();
+#endif
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
-            eeprom_update_byte(target, *source);
+            dynamic_keymap_update_byte(target, *source);
         }
         source++;
         target++;
     }
+#ifdef EEPROM_DRIVER
+    eeprom_driver_batch_end();
+#endif
+    layer_resolution_cache_clear();
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -220,11 +324,11 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   source = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *target = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            *target = eeprom_read_byte(source);
+            *target = dynamic_keymap_read_byte(source);
         } else {
             *target = 0x00;
         }
@@ -234,26 +338,47 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   target = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *source = data;
+#ifdef EEPROM_DRIVER
+    eeprom_driver_batch_begin();
+#endif
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            eeprom_update_byte(target, *source);
+            dynamic_keymap_update_byte(target, *source);
         }
         source++;
         target++;
     }
+#ifdef EEPROM_DRIVER
+    eeprom_driver_batch_end();
+#endif
 }
 
 void dynamic_keymap_macro_reset(void) {
     void *p   = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
     void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+#ifdef EEPROM_DRIVER
+    eeprom_driver_batch_begin();
+#endif
     while (p != end) {
-        eeprom_update_byte(p, 0);
+        dynamic_keymap_update_byte(p, 0);
         ++p;
     }
+#ifdef EEPROM_DRIVER
+    eeprom_driver_batch_end();
+#endif
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    dynamic_keymap_flush();
+#endif
 }
 
+#ifdef SEND_STRING_ASYNC_ENABLE
+static char dynamic_keymap_macro_read(const char *ptr) {
+    return dynamic_keymap_read_byte((const uint8_t *)ptr);
+}
+#endif
+
 void dynamic_keymap_macro_send(uint8_t id) {
     if (id >= DYNAMIC_KEYMAP_MACRO_COUNT) {
         return;
@@ -264,7 +389,7 @@ void dynamic_keymap_macro_send(uint8_t id) {
     // of buffer writing, possibly an aborted buffer
     // write. So do nothing.
     void *p = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - 1);
-    if (eeprom_read_byte(p) != 0) {
+    if (dynamic_keymap_read_byte(p) != 0) {
         return;
     }
 
@@ -278,18 +403,31 @@ void dynamic_keymap_macro_send(uint8_t id) {
         if (p == end) {
             return;
         }
-        if (eeprom_read_byte(p) == 0) {
+        if (dynamic_keymap_read_byte(p) == 0) {
             --id;
         }
         ++p;
     }
 
+#ifdef SEND_STRING_ASYNC_ENABLE
+    // Stream the macro straight out of EEPROM, leaving the main loop running.
+    if (send_string_async_with_reader(p, DYNAMIC_KEYMAP_MACRO_DELAY, dynamic_keymap_macro_read, NULL, NULL)) {
+        return;
+    }
+    // Another string is still being queued, so finish typing it before sending
+    // this one straight away, rather than interleaving the two.
+    while (send_string_async_busy()) {
+        send_string_task();
+        wait_ms(1);
+    }
+#endif
+
     // Send the macro string by making a temporary string.
     char data[8] = {0};
     // We already checked there was a null at the end of
     // the buffer, so this cannot go past the end
     while (1) {
-        data[0] = eeprom_read_byte(p++);
+        data[0] = dynamic_keymap_read_byte(p++);
         data[1] = 0;
         // Stop at the null terminator of this macro string
         if (data[0] == 0) {
@@ -297,14 +435,14 @@ void dynamic_keymap_macro_send(uint8_t id) {
         }
         if (data[0] == SS_QMK_PREFIX) {
             // Get the code
-            data[1] = eeprom_read_byte(p++);
+            data[1] = dynamic_keymap_read_byte(p++);
             // Unexpected null, abort.
             if (data[1] == 0) {
                 return;
             }
             if (data[1] == SS_TAP_CODE || data[1] == SS_DOWN_CODE || data[1] == SS_UP_CODE) {
                 // Get the keycode
-                data[2] = eeprom_read_byte(p++);
+                data[2] = dynamic_keymap_read_byte(p++);
                 // Unexpected null, abort.
                 if (data[2] == 0) {
                     return;
@@ -316,7 +454,7 @@ void dynamic_keymap_macro_send(uint8_t id) {
                 // At most this is 4 digits plus '|'
                 uint8_t i = 2;
                 while (1) {
-                    data[i] = eeprom_read_byte(p++);
+                    data[i] = dynamic_keymap_read_byte(p++);
                     // Unexpected null, abort
                     if (data[i] == 0) {
                         return;
@@ -68,3 +68,11 @@ void     dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t
 void     dynamic_keymap_macro_reset(void);
 
 void dynamic_keymap_macro_send(uint8_t id);
+
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+// With DYNAMIC_KEYMAP_RAM_CACHE, the keymaps, encoder maps and macros are read from a copy held in RAM.
+// Changes are written back to EEPROM once DYNAMIC_KEYMAP_RAM_CACHE_WRITE_DELAY milliseconds have passed
+// without further changes, by dynamic_keymap_task(), or immediately by dynamic_keymap_flush().
+void dynamic_keymap_flush(void);
+void dynamic_keymap_task(void);
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
@@ -32,6 +32,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "keyboard_profiling.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -107,6 +108,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
@@ -143,6 +147,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef LAYER_LOCK_ENABLE
 #    include "layer_lock.h"
 #endif
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_ASYNC_ENABLE)
+#    include "send_string.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -459,6 +466,9 @@ void keyboard_init(void) {
 #ifdef STENO_ENABLE_ALL
     steno_init();
 #endif
+#ifdef COMBO_ENABLE
+    combo_init();
+#endif
 #if defined(NKRO_ENABLE) && defined(FORCE_NKRO)
     keymap_config.nkro = 1;
     eeconfig_update_keymap(keymap_config.raw);
@@ -510,14 +520,25 @@ void switch_events(uint8_t row, uint8_t col, bool pressed) {
 #endif
 }
 
+#if defined(KEYEVENT_TIME_US) && !defined(KEYEVENT_TICK_INTERVAL_US)
+#    define KEYEVENT_TICK_INTERVAL_US 125
+#endif
+
 /**
  * @brief Generates a tick event at a maximum rate of 1KHz that drives the
- * internal QMK state machine.
+ * internal QMK state machine. With KEYEVENT_TIME_US, the rate is instead
+ * limited by KEYEVENT_TICK_INTERVAL_US (8KHz by default).
  */
 static inline void generate_tick_event(void) {
+#ifdef KEYEVENT_TIME_US
+    static uint32_t last_tick = 0;
+    const uint32_t  now       = timer_read_us();
+    if (TIMER_DIFF_32(now, last_tick) >= KEYEVENT_TICK_INTERVAL_US) {
+#else
     static uint16_t last_tick = 0;
     const uint16_t  now       = timer_read();
     if (TIMER_DIFF_16(now, last_tick) != 0) {
+#endif
         action_exec(MAKE_TICK_EVENT);
         last_tick = now;
     }
@@ -667,50 +688,60 @@ void quantum_task(void) {
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+    bool                         matrix_changed        = false;
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_MATRIX, matrix_changed = matrix_task());
+    if (matrix_changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
-    quantum_task();
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_QUANTUM, quantum_task());
+
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_ASYNC_ENABLE)
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_SEND_STRING, send_string_task());
+#endif
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
-    split_watchdog_task();
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_SPLIT_WATCHDOG, split_watchdog_task());
 #endif
 
 #if defined(RGBLIGHT_ENABLE)
-    rgblight_task();
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_RGBLIGHT, rgblight_task());
 #endif
 
 #ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_LED_MATRIX, led_matrix_task());
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_RGB_MATRIX, rgb_matrix_task());
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
 #    if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
-    backlight_task();
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_BACKLIGHT, backlight_task());
 #    endif
 #endif
 
 #ifdef ENCODER_ENABLE
-    if (encoder_task()) {
+    bool encoder_changed = false;
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_ENCODER, encoder_changed = encoder_task());
+    if (encoder_changed) {
         last_encoder_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
+    bool pointing_device_changed = false;
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_POINTING_DEVICE, pointing_device_changed = pointing_device_task());
+    if (pointing_device_changed) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef OLED_ENABLE
-    oled_task();
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_OLED, oled_task());
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) oled_on();
@@ -718,7 +749,7 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ST7565_ENABLE
-    st7565_task();
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_ST7565, st7565_task());
 #    if ST7565_TIMEOUT > 0
     // Wake up display if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) st7565_on();
@@ -727,32 +758,40 @@ void keyboard_task(void) {
 
 #ifdef MOUSEKEY_ENABLE
     // mousekey repeat & acceleration
-    mousekey_task();
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_MOUSEKEY, mousekey_task());
 #endif
 
 #ifdef PS2_MOUSE_ENABLE
-    ps2_mouse_task();
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_PS2_MOUSE, ps2_mouse_task());
 #endif
 
 #ifdef MIDI_ENABLE
-    midi_task();
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_MIDI, midi_task());
 #endif
 
 #ifdef JOYSTICK_ENABLE
-    joystick_task();
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_JOYSTICK, joystick_task());
 #endif
 
 #ifdef BLUETOOTH_ENABLE
-    bluetooth_task();
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_BLUETOOTH, bluetooth_task());
 #endif
 
 #ifdef HAPTIC_ENABLE
-    haptic_task();
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_HAPTIC, haptic_task());
 #endif
 
-    led_task();
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_LED, led_task());
 
 #ifdef OS_DETECTION_ENABLE
-    os_detection_task();
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_OS_DETECTION, os_detection_task());
+#endif
+
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_CACHE)
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_DYNAMIC_KEYMAP, dynamic_keymap_task());
+#endif
+
+#ifdef EEPROM_DRIVER
+    KEYBOARD_PROFILE(KEYBOARD_PROFILING_EEPROM, eeprom_driver_task());
 #endif
 }
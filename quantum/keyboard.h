@@ -40,6 +40,9 @@ typedef struct {
     uint16_t        time;
     keyevent_type_t type;
     bool            pressed;
+#ifdef KEYEVENT_TIME_US
+    uint32_t time_us;
+#endif
 } keyevent_t;
 
 /* equivalent test of keypos_t */
@@ -74,7 +77,22 @@ static inline bool IS_DIPSWITCHEVENT(const keyevent_t event) {
 #define MAKE_KEYPOS(row_num, col_num) ((keypos_t){.row = (row_num), .col = (col_num)})
 
 /* Common keyevent_t object factory */
-#define MAKE_EVENT(row_num, col_num, press, event_type) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = timer_read(), .type = (event_type)})
+#ifdef KEYEVENT_TIME_US
+#    define MAKE_EVENT(row_num, col_num, press, event_type) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = timer_read(), .type = (event_type), .time_us = timer_read_us()})
+#else
+#    define MAKE_EVENT(row_num, col_num, press, event_type) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = timer_read(), .type = (event_type)})
+#endif
+
+/**
+ * @brief Checks whether the later event happened less than `term` milliseconds after the earlier one.
+ *
+ * Compares the microsecond timestamps when KEYEVENT_TIME_US is defined, so sub-millisecond differences count.
+ */
+#ifdef KEYEVENT_TIME_US
+#    define KEYEVENT_WITHIN_TERM(later, earlier, term) (TIMER_DIFF_32((later).time_us, (earlier).time_us) < (uint32_t)(term) * 1000)
+#else
+#    define KEYEVENT_WITHIN_TERM(later, earlier, term) (TIMER_DIFF_16((later).time, (earlier).time) < (term))
+#endif
 
 /**
  * @brief Constructs a key event for a pressed or released key.
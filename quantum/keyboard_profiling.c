@@ -0,0 +1,162 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "keyboard_profiling.h"
+#include "timer.h"
+#include "print.h"
+
+#if !defined(KEYBOARD_PROFILING_TIMESTAMP) && defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#    include "chibios_config.h"
+#endif
+
+#if defined(KEYBOARD_PROFILING_TIMESTAMP)
+// Board supplies KEYBOARD_PROFILING_TIMESTAMP() and KEYBOARD_PROFILING_ELAPSED_US(start)
+#elif defined(PROTOCOL_CHIBIOS) && PORT_SUPPORTS_RT == TRUE
+// The realtime counter is the cycle counter on Cortex-M3 and up, or the 1MHz timer on RP2040
+#    define KEYBOARD_PROFILING_TIMESTAMP() ((uint32_t)chSysGetRealtimeCounterX())
+#    define KEYBOARD_PROFILING_ELAPSED_US(start) ((uint32_t)((rtcnt_t)(chSysGetRealtimeCounterX() - (rtcnt_t)(start)) / ((REALTIME_COUNTER_CLOCK) / 1000000UL)))
+#else
+// Only as fine as the platform's timer_read_us(), which is whole milliseconds on AVR
+#    define KEYBOARD_PROFILING_TIMESTAMP() timer_read_us()
+#    define KEYBOARD_PROFILING_ELAPSED_US(start) timer_elapsed_us(start)
+#endif
+
+static keyboard_profiling_stats_t profiling_stats[KEYBOARD_PROFILING_PHASE_COUNT];
+
+static const char *const phase_names[KEYBOARD_PROFILING_PHASE_COUNT] = {
+    [KEYBOARD_PROFILING_LOOP]            = "loop",
+    [KEYBOARD_PROFILING_MATRIX]          = "matrix",
+    [KEYBOARD_PROFILING_QUANTUM]         = "quantum",
+    [KEYBOARD_PROFILING_SEND_STRING]     = "send_string",
+    [KEYBOARD_PROFILING_SPLIT_WATCHDOG]  = "split_watchdog",
+    [KEYBOARD_PROFILING_RGBLIGHT]        = "rgblight",
+    [KEYBOARD_PROFILING_LED_MATRIX]      = "led_matrix",
+    [KEYBOARD_PROFILING_RGB_MATRIX]      = "rgb_matrix",
+    [KEYBOARD_PROFILING_BACKLIGHT]       = "backlight",
+    [KEYBOARD_PROFILING_ENCODER]         = "encoder",
+    [KEYBOARD_PROFILING_POINTING_DEVICE] = "pointing_device",
+    [KEYBOARD_PROFILING_OLED]            = "oled",
+    [KEYBOARD_PROFILING_ST7565]          = "st7565",
+    [KEYBOARD_PROFILING_MOUSEKEY]        = "mousekey",
+    [KEYBOARD_PROFILING_PS2_MOUSE]       = "ps2_mouse",
+    [KEYBOARD_PROFILING_MIDI]            = "midi",
+    [KEYBOARD_PROFILING_JOYSTICK]        = "joystick",
+    [KEYBOARD_PROFILING_BLUETOOTH]       = "bluetooth",
+    [KEYBOARD_PROFILING_HAPTIC]          = "haptic",
+    [KEYBOARD_PROFILING_LED]             = "led",
+    [KEYBOARD_PROFILING_OS_DETECTION]    = "os_detection",
+    [KEYBOARD_PROFILING_DYNAMIC_KEYMAP]  = "dynamic_keymap",
+    [KEYBOARD_PROFILING_EEPROM]          = "eeprom",
+    [KEYBOARD_PROFILING_PROTOCOL_PRE]    = "protocol_pre",
+    [KEYBOARD_PROFILING_PROTOCOL_POST]   = "protocol_post",
+    [KEYBOARD_PROFILING_RAW_HID]         = "raw_hid",
+    [KEYBOARD_PROFILING_CONSOLE]         = "console",
+    [KEYBOARD_PROFILING_QUANTUM_PAINTER] = "quantum_painter",
+    [KEYBOARD_PROFILING_DEFERRED_EXEC]   = "deferred_exec",
+    [KEYBOARD_PROFILING_HOUSEKEEPING]    = "housekeeping",
+};
+
+uint32_t keyboard_profiling_timestamp(void) {
+    return KEYBOARD_PROFILING_TIMESTAMP();
+}
+
+void keyboard_profiling_record(keyboard_profiling_phase_t phase, uint32_t start) {
+    uint32_t duration = KEYBOARD_PROFILING_ELAPSED_US(start);
+
+    if (phase >= KEYBOARD_PROFILING_PHASE_COUNT) {
+        return;
+    }
+
+    keyboard_profiling_stats_t *stats = &profiling_stats[phase];
+    if (stats->count == 0 || duration < stats->min_us) {
+        stats->min_us = duration;
+    }
+    if (duration > stats->max_us) {
+        stats->max_us = duration;
+    }
+    stats->count++;
+    stats->sum_us += duration;
+
+    uint8_t bucket = 0;
+    while (bucket < KEYBOARD_PROFILING_HISTOGRAM_BUCKETS - 1 && duration >= (1UL << bucket)) {
+        bucket++;
+    }
+    if (stats->histogram[bucket] < UINT16_MAX) {
+        stats->histogram[bucket]++;
+    }
+}
+
+bool keyboard_profiling_get(keyboard_profiling_phase_t phase, keyboard_profiling_stats_t *stats) {
+    if (phase >= KEYBOARD_PROFILING_PHASE_COUNT) {
+        return false;
+    }
+    memcpy(stats, &profiling_stats[phase], sizeof(keyboard_profiling_stats_t));
+    return true;
+}
+
+uint32_t keyboard_profiling_percentile(const keyboard_profiling_stats_t *stats, uint8_t percentile) {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < KEYBOARD_PROFILING_HISTOGRAM_BUCKETS; i++) {
+        total += stats->histogram[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    uint32_t target     = (total * percentile + 99) / 100;
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i < KEYBOARD_PROFILING_HISTOGRAM_BUCKETS - 1; i++) {
+        cumulative += stats->histogram[i];
+        if (cumulative >= target) {
+            uint32_t upper = (1UL << i) - 1;
+            return upper < stats->max_us ? upper : stats->max_us;
+        }
+    }
+    // The last bucket is open-ended
+    return stats->max_us;
+}
+
+const char *keyboard_profiling_phase_name(keyboard_profiling_phase_t phase) {
+    if (phase >= KEYBOARD_PROFILING_PHASE_COUNT) {
+        return "unknown";
+    }
+    return phase_names[phase];
+}
+
+void keyboard_profiling_reset(void) {
+    memset(profiling_stats, 0, sizeof(profiling_stats));
+}
+
+void keyboard_profiling_print(void) {
+    for (uint8_t i = 0; i < KEYBOARD_PROFILING_PHASE_COUNT; i++) {
+        const keyboard_profiling_stats_t *stats = &profiling_stats[i];
+        if (stats->count == 0) {
+            continue;
+        }
+        uprintf("%-16s n=%lu avg=%lu min=%lu max=%lu p50=%lu p90=%lu p99=%lu us\n", phase_names[i], (unsigned long)stats->count, (unsigned long)(stats->sum_us / stats->count), (unsigned long)stats->min_us, (unsigned long)stats->max_us, (unsigned long)keyboard_profiling_percentile(stats, 50), (unsigned long)keyboard_profiling_percentile(stats, 90), (unsigned long)keyboard_profiling_percentile(stats, 99));
+    }
+}
+
+void keyboard_profiling_task(void) {
+    static uint32_t loop_start   = 0;
+    static bool     loop_started = false;
+
+    if (loop_started) {
+        keyboard_profiling_record(KEYBOARD_PROFILING_LOOP, loop_start);
+    }
+
+#ifdef CONSOLE_ENABLE
+    static uint32_t last_print = 0;
+    if (timer_elapsed32(last_print) >= KEYBOARD_PROFILING_INTERVAL) {
+        keyboard_profiling_print();
+        keyboard_profiling_reset();
+        last_print = timer_read32();
+    }
+#endif
+
+    // Start timing the next iteration after printing, so console output isn't attributed to it
+    loop_start   = keyboard_profiling_timestamp();
+    loop_started = true;
+}
@@ -0,0 +1,128 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Per-phase timing of the main loop, enabled with `KEYBOARD_PROFILING_ENABLE = yes`.
+
+    Each phase of keyboard_task() and the main loop is wrapped with KEYBOARD_PROFILE(), which
+    records its duration in microseconds into a min/max/log2-histogram accumulator. Statistics
+    are printed over console every KEYBOARD_PROFILING_INTERVAL milliseconds, and can be read
+    with keyboard_profiling_get() for other transports such as raw HID.
+*/
+
+typedef enum keyboard_profiling_phase_t {
+    KEYBOARD_PROFILING_LOOP, // Whole main loop iteration
+    KEYBOARD_PROFILING_MATRIX,
+    KEYBOARD_PROFILING_QUANTUM,
+    KEYBOARD_PROFILING_SEND_STRING,
+    KEYBOARD_PROFILING_SPLIT_WATCHDOG,
+    KEYBOARD_PROFILING_RGBLIGHT,
+    KEYBOARD_PROFILING_LED_MATRIX,
+    KEYBOARD_PROFILING_RGB_MATRIX,
+    KEYBOARD_PROFILING_BACKLIGHT,
+    KEYBOARD_PROFILING_ENCODER,
+    KEYBOARD_PROFILING_POINTING_DEVICE,
+    KEYBOARD_PROFILING_OLED,
+    KEYBOARD_PROFILING_ST7565,
+    KEYBOARD_PROFILING_MOUSEKEY,
+    KEYBOARD_PROFILING_PS2_MOUSE,
+    KEYBOARD_PROFILING_MIDI,
+    KEYBOARD_PROFILING_JOYSTICK,
+    KEYBOARD_PROFILING_BLUETOOTH,
+    KEYBOARD_PROFILING_HAPTIC,
+    KEYBOARD_PROFILING_LED,
+    KEYBOARD_PROFILING_OS_DETECTION,
+    KEYBOARD_PROFILING_DYNAMIC_KEYMAP,
+    KEYBOARD_PROFILING_EEPROM,
+    KEYBOARD_PROFILING_PROTOCOL_PRE,
+    KEYBOARD_PROFILING_PROTOCOL_POST,
+    KEYBOARD_PROFILING_RAW_HID,
+    KEYBOARD_PROFILING_CONSOLE,
+    KEYBOARD_PROFILING_QUANTUM_PAINTER,
+    KEYBOARD_PROFILING_DEFERRED_EXEC,
+    KEYBOARD_PROFILING_HOUSEKEEPING,
+    KEYBOARD_PROFILING_PHASE_COUNT,
+} keyboard_profiling_phase_t;
+
+#ifdef KEYBOARD_PROFILING_ENABLE
+
+#    ifndef KEYBOARD_PROFILING_INTERVAL
+#        define KEYBOARD_PROFILING_INTERVAL 5000
+#    endif
+
+// Bucket `n` counts durations in [2^(n-1), 2^n) us, bucket 0 counts durations below 1 us
+#    ifndef KEYBOARD_PROFILING_HISTOGRAM_BUCKETS
+#        define KEYBOARD_PROFILING_HISTOGRAM_BUCKETS 16
+#    endif
+
+typedef struct keyboard_profiling_stats_t {
+    uint32_t count;
+    uint32_t sum_us;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint16_t histogram[KEYBOARD_PROFILING_HISTOGRAM_BUCKETS];
+} keyboard_profiling_stats_t;
+
+/**
+ * @brief Returns the current profiling timestamp, in platform-specific ticks.
+ */
+uint32_t keyboard_profiling_timestamp(void);
+
+/**
+ * @brief Records the duration of a phase which started at `start`.
+ */
+void keyboard_profiling_record(keyboard_profiling_phase_t phase, uint32_t start);
+
+/**
+ * @brief Retrieves the statistics accumulated for a phase since the last reset.
+ *
+ * @return false if the phase is invalid
+ */
+bool keyboard_profiling_get(keyboard_profiling_phase_t phase, keyboard_profiling_stats_t *stats);
+
+/**
+ * @brief Estimates a percentile (0-100) of a phase's duration from its histogram.
+ *
+ * @return The upper bound, in microseconds, of the histogram bucket containing the percentile
+ */
+uint32_t keyboard_profiling_percentile(const keyboard_profiling_stats_t *stats, uint8_t percentile);
+
+/**
+ * @brief Returns a printable name for a phase.
+ */
+const char *keyboard_profiling_phase_name(keyboard_profiling_phase_t phase);
+
+/**
+ * @brief Clears all accumulated statistics.
+ */
+void keyboard_profiling_reset(void);
+
+/**
+ * @brief Prints all phases that ran since the last reset over console.
+ */
+void keyboard_profiling_print(void);
+
+/**
+ * @brief Periodically prints and resets the statistics. Called from the main loop.
+ */
+void keyboard_profiling_task(void);
+
+#    define KEYBOARD_PROFILE(phase, ...)                                        \
+        do {                                                                    \
+            uint32_t keyboard_profiling_start = keyboard_profiling_timestamp(); \
+            __VA_ARGS__;                                                        \
+            keyboard_profiling_record((phase), keyboard_profiling_start);       \
+        } while (0)
+
+#else
+
+#    define KEYBOARD_PROFILE(phase, ...) \
+        do {                             \
+            __VA_ARGS__;                 \
+        } while (0)
+
+#endif // KEYBOARD_PROFILING_ENABLE
@@ -15,6 +15,7 @@
  */
 
 #include "keyboard.h"
+#include "keyboard_profiling.h"
 
 void platform_setup(void);
 
@@ -46,32 +47,39 @@ int main(void) {
 
     /* Main loop */
     while (true) {
-        protocol_pre_task();
+        KEYBOARD_PROFILE(KEYBOARD_PROFILING_PROTOCOL_PRE, protocol_pre_task());
         protocol_keyboard_task();
-        protocol_post_task();
+        KEYBOARD_PROFILE(KEYBOARD_PROFILING_PROTOCOL_POST, protocol_post_task());
 
 #ifdef RAW_ENABLE
         void raw_hid_task(void);
-        raw_hid_task();
+        KEYBOARD_PROFILE(KEYBOARD_PROFILING_RAW_HID, raw_hid_task());
 #endif
 
 #ifdef CONSOLE_ENABLE
         void console_task(void);
-        console_task();
+        KEYBOARD_PROFILE(KEYBOARD_PROFILING_CONSOLE, console_task());
 #endif
 
 #ifdef QUANTUM_PAINTER_ENABLE
         // Run Quantum Painter task
         void qp_internal_task(void);
-        qp_internal_task();
+        KEYBOARD_PROFILE(KEYBOARD_PROFILING_QUANTUM_PAINTER, qp_internal_task());
 #endif
 
 #ifdef DEFERRED_EXEC_ENABLE
-        // Run deferred executions
-        void deferred_exec_task(void);
-        deferred_exec_task();
+        // Run deferred executions, if any are due
+        uint32_t deferred_exec_time_until_next(void);
+        if (deferred_exec_time_until_next() == 0) {
+            void deferred_exec_task(void);
+            KEYBOARD_PROFILE(KEYBOARD_PROFILING_DEFERRED_EXEC, deferred_exec_task());
+        }
 #endif // DEFERRED_EXEC_ENABLE
 
-        housekeeping_task();
+        KEYBOARD_PROFILE(KEYBOARD_PROFILING_HOUSEKEEPING, housekeeping_task());
+
+#ifdef KEYBOARD_PROFILING_ENABLE
+        keyboard_profiling_task();
+#endif
     }
 }
@@ -75,6 +75,9 @@ extern uint8_t thisHand, thatHand;
 __attribute__((weak)) void matrix_init_pins(void);
 __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row);
 __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[], uint8_t current_col, matrix_row_t row_shifter);
+#ifdef MATRIX_SCAN_ON_ACTIVITY
+__attribute__((weak)) bool matrix_has_activity(void);
+#endif
 
 static inline void gpio_atomic_set_pin_output_low(pin_t pin) {
     ATOMIC_BLOCK_FORCEON {
@@ -133,6 +136,19 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     current_matrix[current_row] = current_row_value;
 }
 
+#    ifdef MATRIX_SCAN_ON_ACTIVITY
+__attribute__((weak)) bool matrix_has_activity(void) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (!readMatrixPin(direct_pins[row][col])) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+#    endif
+
 #elif defined(DIODE_DIRECTION)
 #    if defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
 #        if (DIODE_DIRECTION == COL2ROW)
@@ -198,6 +214,26 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     current_matrix[current_row] = current_row_value;
 }
 
+#            ifdef MATRIX_SCAN_ON_ACTIVITY
+__attribute__((weak)) bool matrix_has_activity(void) {
+    bool key_pressed = false;
+
+    // Select all rows at once, any closed switch pulls its col low
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        select_row(row);
+    }
+    matrix_output_select_delay();
+
+    for (uint8_t col = 0; col < MATRIX_COLS && !key_pressed; col++) {
+        key_pressed = !readMatrixPin(col_pins[col]);
+    }
+
+    unselect_rows();
+    matrix_output_unselect_delay(0, key_pressed);
+    return key_pressed;
+}
+#            endif
+
 #        elif (DIODE_DIRECTION == ROW2COL)
 
 static bool select_col(uint8_t col) {
@@ -262,9 +298,34 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
     matrix_output_unselect_delay(current_col, key_pressed); // wait for all Row signals to go HIGH
 }
 
+#            ifdef MATRIX_SCAN_ON_ACTIVITY
+__attribute__((weak)) bool matrix_has_activity(void) {
+    bool key_pressed = false;
+
+    // Select all cols at once, any closed switch pulls its row low
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        select_col(col);
+    }
+    matrix_output_select_delay();
+
+    for (uint8_t row = 0; row < ROWS_PER_HAND && !key_pressed; row++) {
+        key_pressed = !readMatrixPin(row_pins[row]);
+    }
+
+    unselect_cols();
+    matrix_output_unselect_delay(0, key_pressed);
+    return key_pressed;
+}
+#            endif
+
 #        else
 #            error DIODE_DIRECTION must be one of COL2ROW or ROW2COL!
 #        endif
+#    elif defined(MATRIX_SCAN_ON_ACTIVITY)
+// Without a known pin layout, custom matrix_read_* implementations always need a full scan
+__attribute__((weak)) bool matrix_has_activity(void) {
+    return true;
+}
 #    endif // defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
 #else
 #    error DIODE_DIRECTION is not defined!
@@ -320,21 +381,42 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 }
 #endif
 
+#ifdef MATRIX_SCAN_ON_ACTIVITY
+bool matrix_is_idle(void) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+#    ifdef SPLIT_KEYBOARD
+        if (raw_matrix[row] || matrix[thisHand + row]) {
+#    else
+        if (raw_matrix[row] || matrix[row]) {
+#    endif
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
 uint8_t matrix_scan(void) {
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
+#ifdef MATRIX_SCAN_ON_ACTIVITY
+    // While nothing is held or debouncing, a single read of all lines replaces the full scan
+    if (!matrix_is_idle() || matrix_has_activity())
+#endif
+    {
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
-    // Set row, read cols
-    for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
-        matrix_read_cols_on_row(curr_matrix, current_row);
-    }
+        // Set row, read cols
+        for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
+            matrix_read_cols_on_row(curr_matrix, current_row);
+        }
 #elif (DIODE_DIRECTION == ROW2COL)
-    // Set col, read rows
-    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
-    for (uint8_t current_col = 0; current_col < MATRIX_COLS; current_col++, row_shifter <<= 1) {
-        matrix_read_rows_on_col(curr_matrix, current_col, row_shifter);
-    }
+        // Set col, read rows
+        matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+        for (uint8_t current_col = 0; current_col < MATRIX_COLS; current_col++, row_shifter <<= 1) {
+            matrix_read_rows_on_col(curr_matrix, current_col, row_shifter);
+        }
 #endif
+    }
 
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
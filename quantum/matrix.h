@@ -65,6 +65,13 @@ void matrix_output_unselect_delay(uint8_t line, bool key_pressed);
 /* only for backwards compatibility. delay between changing matrix pin state and reading values */
 void matrix_io_delay(void);
 
+#ifdef MATRIX_SCAN_ON_ACTIVITY
+/* whether any switch is closed, read in a single pass with all lines selected */
+bool matrix_has_activity(void);
+/* whether no keys are held and debouncing has settled, so scanning only checks for activity */
+bool matrix_is_idle(void);
+#endif
+
 /* power control */
 void matrix_power_up(void);
 void matrix_power_down(void);
@@ -47,9 +47,12 @@ extern "C" {
  */
 
 #include "midi_function_types.h"
-#include "bytequeue/bytequeue.h"
+#include "ring_buffer.h"
 #define MIDI_INPUT_QUEUE_LENGTH 192
 
+// The ring keeps one slot free, so this holds one byte less than the queue length
+RING_BUFFER_DEFINE(midi_input_queue, uint8_t, MIDI_INPUT_QUEUE_LENGTH - 1)
+
 typedef enum { IDLE, ONE_BYTE_MESSAGE = 1, TWO_BYTE_MESSAGE = 2, THREE_BYTE_MESSAGE = 3, SYSEX_MESSAGE } input_state_t;
 
 typedef void (*midi_no_byte_func_t)(MidiDevice* device);
@@ -102,8 +105,7 @@ struct _midi_device {
     uint16_t      input_count;
 
     // for queueing data between the input and the processing functions
-    uint8_t     input_queue_data[MIDI_INPUT_QUEUE_LENGTH];
-    byteQueue_t input_queue;
+    midi_input_queue_t input_queue;
 };
 
 /**
@@ -56,6 +56,15 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the number of recently-used glyph lookups remembered by each loaded font, so that repeated
+ *      characters do not need their glyph table entry read again from the font. Each entry uses 8 bytes of RAM per
+ *      font. Setting this to 0 disables the cache.
+ */
+#    define QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE 8
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -72,6 +81,23 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_BULK_DECODE
+/**
+ * @def This controls whether image and font pixel data is decoded in spans of bytes, rather than one byte and one pixel
+ *      at a time. Drawing is significantly faster, at the cost of a little flash and \ref QUANTUM_PAINTER_SPAN_SIZE bytes
+ *      of extra stack use while drawing.
+ */
+#    define QUANTUM_PAINTER_BULK_DECODE TRUE
+#endif
+
+#ifndef QUANTUM_PAINTER_SPAN_SIZE
+/**
+ * @def The number of bytes decoded from an image or font at a time, when \ref QUANTUM_PAINTER_BULK_DECODE is enabled.
+ *      Must be a multiple of 8.
+ */
+#    define QUANTUM_PAINTER_SPAN_SIZE 64
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
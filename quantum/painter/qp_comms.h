@@ -15,6 +15,8 @@ bool     qp_comms_init(painter_device_t device);
 bool     qp_comms_start(painter_device_t device);
 void     qp_comms_stop(painter_device_t device);
 uint32_t qp_comms_send(painter_device_t device, const void* data, uint32_t byte_count);
+bool     qp_comms_send_async(painter_device_t device, const void* data, uint32_t byte_count);
+bool     qp_comms_send_async_complete(painter_device_t device);
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
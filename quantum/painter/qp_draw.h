@@ -36,6 +36,9 @@ bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count,
 bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_pixel_output_callback output_callback, void* output_arg);
 bool qp_internal_send_bytes(painter_device_t device, uint32_t byte_count, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_byte_output_callback output_callback, void* output_arg);
 
+// Bulk variant of qp_internal_byte_input_callback -- decodes up to max_bytes into the buffer, returning the number of bytes written (zero or negative on failure)
+typedef int32_t (*qp_internal_byte_span_input_callback)(void* cb_arg, uint8_t* buffer, uint32_t max_bytes);
+
 // Global variable used for interpolated pixel lookup table.
 #if QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 extern qp_pixel_t qp_internal_global_pixel_lookup_table[256];
@@ -64,9 +67,10 @@ enum qp_internal_rle_mode_t {
 };
 
 typedef struct qp_internal_byte_input_state_t {
-    painter_device_t device;
-    qp_stream_t*     src_stream;
-    int16_t          curr;
+    painter_device_t                     device;
+    qp_stream_t*                         src_stream;
+    int16_t                              curr;
+    qp_internal_byte_span_input_callback span_callback; // set by qp_internal_prepare_input_state() when bulk decoding is available
     union {
         // RLE-specific
         struct {
@@ -92,9 +96,16 @@ typedef struct qp_internal_byte_output_state_t {
 
 bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg);
 
+#if QUANTUM_PAINTER_BULK_DECODE
+// Span-based equivalents of (qp_internal_decode_palette + qp_internal_pixel_appender) and (qp_internal_send_bytes + qp_internal_byte_appender)
+bool qp_internal_decode_palette_span(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_span_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_state_t* output_state);
+bool qp_internal_send_bytes_span(painter_device_t device, uint32_t byte_count, qp_internal_byte_span_input_callback input_callback, void* input_arg, qp_internal_byte_output_state_t* output_state);
+#endif // QUANTUM_PAINTER_BULK_DECODE
+
 // Helper shared between image and font rendering, sends pixels to the display using:
 //     - qp_internal_decode_palette + qp_internal_pixel_appender (bpp <= 8)
 //     - qp_internal_send_bytes                                  (bpp > 8)
-bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state);
+// or their span-based equivalents, if the input state provides a span callback.
+bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, qp_internal_byte_input_state_t* input_state);
 
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression);
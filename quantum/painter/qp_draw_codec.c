@@ -2,6 +2,8 @@
 // Copyright 2023 Pablo Martinez (@elpekenin) <elpekenin@elpekenin.dev>
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
+
 #include "qp_internal.h"
 #include "qp_draw.h"
 #include "qp_comms.h"
@@ -126,6 +128,73 @@ static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     return c;
 }
 
+#if QUANTUM_PAINTER_BULK_DECODE
+
+static int32_t qp_drawimage_span_uncompressed_decoder(void* cb_arg, uint8_t* buffer, uint32_t max_bytes) {
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
+    return (int32_t)qp_stream_read(buffer, 1, max_bytes, state->src_stream);
+}
+
+// Shares its state with qp_drawimage_byte_rle_decoder: outside of MARKER_BYTE mode, `curr` is the next byte to return and `remain` includes it
+static int32_t qp_drawimage_span_rle_decoder(void* cb_arg, uint8_t* buffer, uint32_t max_bytes) {
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
+
+    uint32_t written = 0;
+    while (written < max_bytes) {
+        // Work out if we're parsing the initial marker byte
+        if (state->rle.mode == MARKER_BYTE) {
+            int16_t c = qp_stream_get(state->src_stream);
+            if (c < 0) {
+                break;
+            }
+            if (c >= 128) {
+                state->rle.mode   = NON_REPEATING_RUN; // non-repeated run
+                state->rle.remain = c - 127;
+            } else {
+                state->rle.mode   = REPEATING_RUN; // repeated run
+                state->rle.remain = c;
+            }
+
+            state->curr = qp_stream_get(state->src_stream);
+            if (state->curr < 0 || state->rle.remain == 0) {
+                return -1;
+            }
+        }
+
+        uint32_t count = max_bytes - written;
+        if (count > state->rle.remain) {
+            count = state->rle.remain;
+        }
+
+        if (state->rle.mode == REPEATING_RUN) {
+            // Repeated runs are expanded as a fill
+            memset(&buffer[written], state->curr, count);
+        } else {
+            // Non-repeated runs are copied, with the first byte already read ahead
+            buffer[written] = state->curr;
+            if (count > 1 && qp_stream_read(&buffer[written + 1], 1, count - 1, state->src_stream) != count - 1) {
+                return -1;
+            }
+        }
+
+        written += count;
+        state->rle.remain -= count;
+        if (state->rle.remain > 0) {
+            // If we're in a non-repeating run, queue up the next byte
+            if (state->rle.mode == NON_REPEATING_RUN) {
+                state->curr = qp_stream_get(state->src_stream);
+            }
+        } else {
+            // Swap back to querying the marker byte mode
+            state->rle.mode = MARKER_BYTE;
+        }
+    }
+
+    return written > 0 ? (int32_t)written : -1;
+}
+
+#endif // QUANTUM_PAINTER_BULK_DECODE
+
 bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
     qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
     painter_driver_t*                 driver = (painter_driver_t*)state->device;
@@ -165,8 +234,183 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
     return true;
 }
 
+#if QUANTUM_PAINTER_BULK_DECODE
+
+_Static_assert(QUANTUM_PAINTER_SPAN_SIZE > 0 && (QUANTUM_PAINTER_SPAN_SIZE % 8) == 0, "QUANTUM_PAINTER_SPAN_SIZE must be a multiple of 8");
+
+// If we've hit the transmit limit, send out the entire buffer and reset the write position
+static inline bool qp_internal_pixel_flush_if_full(qp_internal_pixel_output_state_t* state) {
+    painter_driver_t* driver = (painter_driver_t*)state->device;
+    if (state->pixel_write_pos == state->max_pixels) {
+        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+            return false;
+        }
+        state->pixel_write_pos = 0;
+    }
+    return true;
+}
+
+// Appends unpacked palette indices, splitting at the transmit limit
+static bool qp_internal_append_indices(qp_internal_pixel_output_state_t* state, qp_pixel_t* palette, uint8_t* indices, uint32_t count) {
+    painter_driver_t* driver = (painter_driver_t*)state->device;
+    while (count > 0) {
+        uint32_t n = state->max_pixels - state->pixel_write_pos;
+        if (n > count) {
+            n = count;
+        }
+        if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos, n, indices)) {
+            return false;
+        }
+        state->pixel_write_pos += n;
+        indices += n;
+        count -= n;
+        if (!qp_internal_pixel_flush_if_full(state)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Unpacks palette indices stored LSB-first at bits_per_pixel into one byte each
+static inline void qp_internal_unpack_indices(uint8_t* indices, const uint8_t* packed, uint32_t pixel_count, uint8_t bits_per_pixel) {
+    if (bits_per_pixel == 8) {
+        memcpy(indices, packed, pixel_count);
+        return;
+    }
+
+    const uint8_t pixel_bitmask   = (1 << bits_per_pixel) - 1;
+    const uint8_t pixels_per_byte = 8 / bits_per_pixel;
+    uint32_t      i               = 0;
+    while (i < pixel_count) {
+        uint8_t byteval = *packed++;
+        for (uint8_t q = 0; q < pixels_per_byte && i < pixel_count; ++q) {
+            indices[i++] = byteval & pixel_bitmask;
+            byteval >>= bits_per_pixel;
+        }
+    }
+}
+
+// Appends packed palette indices, handing whole bytes to the driver if it supports them
+static bool qp_internal_append_packed(qp_internal_pixel_output_state_t* state, qp_pixel_t* palette, uint8_t bits_per_pixel, const uint8_t* packed, uint32_t pixel_count) {
+    painter_driver_t* driver          = (painter_driver_t*)state->device;
+    const uint8_t     pixels_per_byte = 8 / bits_per_pixel;
+    uint8_t           indices[QUANTUM_PAINTER_SPAN_SIZE];
+
+    if (!driver->driver_vtable->append_packed) {
+        while (pixel_count > 0) {
+            uint32_t n = pixel_count < QUANTUM_PAINTER_SPAN_SIZE ? pixel_count : QUANTUM_PAINTER_SPAN_SIZE;
+            qp_internal_unpack_indices(indices, packed, n, bits_per_pixel);
+            if (!qp_internal_append_indices(state, palette, indices, n)) {
+                return false;
+            }
+            packed += n / pixels_per_byte;
+            pixel_count -= n;
+        }
+        return true;
+    }
+
+    while (pixel_count > 0) {
+        uint32_t space = state->max_pixels - state->pixel_write_pos;
+        uint32_t n     = space - (space % pixels_per_byte);
+        if (n > pixel_count) {
+            n = pixel_count;
+        }
+
+        if (n > 0) {
+            if (!driver->driver_vtable->append_packed(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos, n, bits_per_pixel, packed)) {
+                return false;
+            }
+            state->pixel_write_pos += n;
+            if (!qp_internal_pixel_flush_if_full(state)) {
+                return false;
+            }
+        } else {
+            // The transmit limit falls part-way through this byte, so split it
+            n = pixel_count < pixels_per_byte ? pixel_count : pixels_per_byte;
+            qp_internal_unpack_indices(indices, packed, n, bits_per_pixel);
+            if (!qp_internal_append_indices(state, palette, indices, n)) {
+                return false;
+            }
+        }
+
+        packed += n / pixels_per_byte;
+        pixel_count -= n;
+    }
+    return true;
+}
+
+bool qp_internal_decode_palette_span(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_span_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_state_t* output_state) {
+    const uint8_t pixels_per_byte = 8 / bits_per_pixel;
+    uint8_t       packed[QUANTUM_PAINTER_SPAN_SIZE];
+    while (pixel_count > 0) {
+        uint32_t byte_count = (pixel_count + pixels_per_byte - 1) / pixels_per_byte; // don't read past the end, we may not use an entire byte
+        if (byte_count > sizeof(packed)) {
+            byte_count = sizeof(packed);
+        }
+
+        int32_t bytes_read = input_callback(input_arg, packed, byte_count);
+        if (bytes_read <= 0) {
+            return false;
+        }
+
+        uint32_t loop_pixels = (uint32_t)bytes_read * pixels_per_byte;
+        if (loop_pixels > pixel_count) {
+            loop_pixels = pixel_count;
+        }
+        if (!qp_internal_append_packed(output_state, palette, bits_per_pixel, packed, loop_pixels)) {
+            return false;
+        }
+        pixel_count -= loop_pixels;
+    }
+    return true;
+}
+
+bool qp_internal_send_bytes_span(painter_device_t device, uint32_t byte_count, qp_internal_byte_span_input_callback input_callback, void* input_arg, qp_internal_byte_output_state_t* output_state) {
+    painter_driver_t* driver = (painter_driver_t*)device;
+    uint8_t           pixdata[QUANTUM_PAINTER_SPAN_SIZE];
+    while (byte_count > 0) {
+        uint32_t loop_bytes = output_state->max_bytes - output_state->byte_write_pos;
+        if (loop_bytes > byte_count) {
+            loop_bytes = byte_count;
+        }
+        if (loop_bytes > sizeof(pixdata)) {
+            loop_bytes = sizeof(pixdata);
+        }
+
+        int32_t bytes_read = input_callback(input_arg, pixdata, loop_bytes);
+        if (bytes_read <= 0) {
+            return false;
+        }
+
+        if (driver->driver_vtable->append_pixspan) {
+            if (!driver->driver_vtable->append_pixspan(device, qp_internal_global_pixdata_buffer, output_state->byte_write_pos, pixdata, bytes_read)) {
+                return false;
+            }
+        } else {
+            for (int32_t i = 0; i < bytes_read; ++i) {
+                if (!driver->driver_vtable->append_pixdata(device, qp_internal_global_pixdata_buffer, output_state->byte_write_pos + i, pixdata[i])) {
+                    return false;
+                }
+            }
+        }
+        output_state->byte_write_pos += bytes_read;
+        byte_count -= bytes_read;
+
+        // If we've hit the transmit limit, send out the entire buffer and reset the write position
+        if (output_state->byte_write_pos == output_state->max_bytes) {
+            if (!driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+                return false;
+            }
+            output_state->byte_write_pos = 0;
+        }
+    }
+    return true;
+}
+
+#endif // QUANTUM_PAINTER_BULK_DECODE
+
 // Helper shared between image and font rendering -- uses either (qp_internal_decode_palette + qp_internal_pixel_appender) or (qp_internal_send_bytes) to send data data to the display based on the asset's native-ness
-bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state) {
+bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, qp_internal_byte_input_state_t* input_state) {
     painter_driver_t* driver = (painter_driver_t*)device;
 
     bool ret = false;
@@ -177,7 +421,14 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
         qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
 
         // Decode the pixel data and stream to the display
-        ret = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
+#if QUANTUM_PAINTER_BULK_DECODE
+        if (input_state->span_callback) {
+            ret = qp_internal_decode_palette_span(device, pixel_count, bpp, input_state->span_callback, input_state, qp_internal_global_pixel_lookup_table, &output_state);
+        } else
+#endif // QUANTUM_PAINTER_BULK_DECODE
+        {
+            ret = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
+        }
         // Any leftovers need transmission as well.
         if (ret && output_state.pixel_write_pos > 0) {
             ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
@@ -194,7 +445,14 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
 
         // Stream the raw pixel data to the display
         uint32_t byte_count = pixel_count * bpp / 8;
-        ret                 = qp_internal_send_bytes(device, byte_count, input_callback, input_state, qp_internal_byte_appender, &output_state);
+#if QUANTUM_PAINTER_BULK_DECODE
+        if (input_state->span_callback) {
+            ret = qp_internal_send_bytes_span(device, byte_count, input_state->span_callback, input_state, &output_state);
+        } else
+#endif // QUANTUM_PAINTER_BULK_DECODE
+        {
+            ret = qp_internal_send_bytes(device, byte_count, input_callback, input_state, qp_internal_byte_appender, &output_state);
+        }
         // Any leftovers need transmission as well.
         if (ret && output_state.byte_write_pos > 0) {
             ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
@@ -205,12 +463,19 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
 }
 
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression) {
+    input_state->span_callback = NULL;
     switch (compression) {
         case IMAGE_UNCOMPRESSED:
+#if QUANTUM_PAINTER_BULK_DECODE
+            input_state->span_callback = qp_drawimage_span_uncompressed_decoder;
+#endif // QUANTUM_PAINTER_BULK_DECODE
             return qp_drawimage_byte_uncompressed_decoder;
         case IMAGE_COMPRESSED_RLE:
             input_state->rle.mode   = MARKER_BYTE;
             input_state->rle.remain = 0;
+#if QUANTUM_PAINTER_BULK_DECODE
+            input_state->span_callback = qp_drawimage_span_rle_decoder;
+#endif // QUANTUM_PAINTER_BULK_DECODE
             return qp_drawimage_byte_rle_decoder;
         default:
             return NULL;
@@ -12,15 +12,31 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QFF font handles
 
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+// A resolved glyph, as remembered by the per-font glyph cache
+typedef struct qff_glyph_cache_entry_t {
+    uint32_t code_point : 24;
+    uint32_t width : 8;
+    uint32_t data_offset; // absolute position of the glyph's pixel data in the font stream
+} qff_glyph_cache_entry_t;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
 typedef struct qff_font_handle_t {
     painter_font_desc_t   base;
     bool                  validate_ok;
     bool                  has_ascii_table;
     uint16_t              num_unicode_glyphs;
+    bool                  unicode_glyphs_sorted;
     uint8_t               bpp;
     bool                  has_palette;
     bool                  is_panel_native;
     painter_compression_t compression_scheme;
+    uint32_t              unicode_table_offset; // position of the first unicode glyph entry
+    uint32_t              glyph_data_offset;    // position of the first byte of glyph pixel data
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    uint8_t                 glyph_cache_count;
+    qff_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE]; // most-recently used first
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
     union {
         qp_stream_t        stream;
         qp_memory_stream_t mem_stream;
@@ -39,6 +55,32 @@ static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
+// Returns true if the unicode glyph table is in strictly ascending code point order
+static bool qp_load_font_check_unicode_order(qff_font_handle_t *font) {
+    if (font->num_unicode_glyphs < 2) {
+        return true;
+    }
+
+    if (qp_stream_setpos(&font->stream, font->unicode_table_offset) < 0) {
+        return false;
+    }
+
+    qff_unicode_glyph_v1_t glyph_info;
+    uint32_t               last_code_point = 0;
+    for (uint16_t i = 0; i < font->num_unicode_glyphs; ++i) {
+        if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &font->stream) != 1) {
+            return false;
+        }
+        if (i > 0 && glyph_info.code_point <= last_code_point) {
+            qp_dprintf("qp_load_font: unicode glyph table is unsorted, falling back to linear search\n");
+            return false;
+        }
+        last_code_point = glyph_info.code_point;
+    }
+
+    return true;
+}
+
 static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_font_handle_t *font, void *arg), void *arg) {
     qp_dprintf("qp_load_font: entry\n");
     qff_font_handle_t *font = NULL;
@@ -106,6 +148,23 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
         return NULL;
     }
 
+    // Work out where the glyph tables and data live, so that lookups don't need to recalculate them
+    font->unicode_table_offset = sizeof(qff_font_descriptor_v1_t)                                 // Skip the font descriptor
+                                 + (font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
+                                 + sizeof(qgf_block_header_v1_t);                                   // Skip the unicode block header
+    font->glyph_data_offset    = sizeof(qff_font_descriptor_v1_t)                                                                                                              // Skip the font descriptor
+                              + (font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                               // Skip the ascii table
+                              + (font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
+                              + (font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                    // Skip the palette
+                              + sizeof(qgf_block_header_v1_t);                                                                                                                 // Skip the data block header
+
+    // The unicode table can only be binary-searched if it's sorted by code point, which fonts generated by older tooling may not be
+    font->unicode_glyphs_sorted = qp_load_font_check_unicode_order(font);
+
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    font->glyph_cache_count = 0;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
     // Validation success, we can return the handle
     font->validate_ok = true;
     qp_dprintf("qp_load_font: ok\n");
@@ -151,6 +210,11 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    // Forget any glyphs resolved against this font
+    qff_font->glyph_cache_count = 0;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -214,7 +278,23 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     return true;
 }
 
-static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+// Reads the unicode glyph table entry at the specified index
+static inline bool qp_drawtext_read_unicode_glyph(qff_font_handle_t *qff_font, uint16_t index, qff_unicode_glyph_v1_t *glyph_info) {
+    if (qp_stream_setpos(&qff_font->stream, qff_font->unicode_table_offset + index * sizeof(qff_unicode_glyph_v1_t)) < 0) {
+        qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+        return false;
+    }
+
+    if (qp_stream_read(glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+        qp_dprintf("Failed to read unicode glyph info\n");
+        return false;
+    }
+
+    return true;
+}
+
+// Finds the glyph table value (width and offset) for the specified code point
+static inline bool qp_drawtext_lookup_glyph(qff_font_handle_t *qff_font, uint32_t code_point, uint32_t *glyph_value) {
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
         qff_ascii_glyph_v1_t glyph_info;
@@ -231,34 +311,38 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             return false;
         }
 
-        uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-        uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                               + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing ascii glyph data\n");
-            return false;
-        }
-
-        *width = glyph_width;
+        *glyph_value = glyph_info.value;
         return true;
-    } else {
-        // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
-        uint32_t glyph_info_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
-                                     + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
-                                     + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
+    }
 
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
+    // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
+    qff_unicode_glyph_v1_t glyph_info;
+    if (qff_font->unicode_glyphs_sorted) {
+        // Binary search, as the table is ordered by code point
+        uint16_t lo = 0;
+        uint16_t hi = qff_font->num_unicode_glyphs;
+        while (lo < hi) {
+            uint16_t mid = lo + (hi - lo) / 2;
+            if (!qp_drawtext_read_unicode_glyph(qff_font, mid, &glyph_info)) {
+                return false;
+            }
+
+            if (glyph_info.code_point == code_point) {
+                *glyph_value = glyph_info.value;
+                return true;
+            } else if (glyph_info.code_point < code_point) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+    } else {
+        // Linear search, reading the table sequentially
+        if (qp_stream_setpos(&qff_font->stream, qff_font->unicode_table_offset) < 0) {
             qp_dprintf("Failed to set stream position while preparing glyph data\n");
             return false;
         }
 
-        qff_unicode_glyph_v1_t glyph_info;
         for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
             if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
                 qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
@@ -266,32 +350,77 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             }
 
             if (glyph_info.code_point == code_point) {
-                uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-                uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
-                    return false;
-                }
-
-                *width = glyph_width;
+                *glyph_value = glyph_info.value;
                 return true;
             }
         }
+    }
 
-        // Not found
-        qp_dprintf("Failed to find unicode glyph info\n");
-        return false;
+    // Not found
+    qp_dprintf("Failed to find unicode glyph info\n");
+    return false;
+}
+
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+// Looks up a previously-resolved glyph, moving it to the front of the cache if found
+static inline bool qp_drawtext_glyph_cache_get(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width, uint32_t *data_offset) {
+    for (uint8_t i = 0; i < qff_font->glyph_cache_count; ++i) {
+        if (qff_font->glyph_cache[i].code_point == code_point) {
+            qff_glyph_cache_entry_t entry = qff_font->glyph_cache[i];
+            memmove(&qff_font->glyph_cache[1], &qff_font->glyph_cache[0], i * sizeof(qff_glyph_cache_entry_t));
+            qff_font->glyph_cache[0] = entry;
+
+            *width       = entry.width;
+            *data_offset = entry.data_offset;
+            return true;
+        }
     }
     return false;
 }
 
+// Remembers a resolved glyph, evicting the least-recently used one if the cache is full
+static inline void qp_drawtext_glyph_cache_put(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint32_t data_offset) {
+    if (qff_font->glyph_cache_count < QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE) {
+        ++qff_font->glyph_cache_count;
+    }
+    memmove(&qff_font->glyph_cache[1], &qff_font->glyph_cache[0], (qff_font->glyph_cache_count - 1) * sizeof(qff_glyph_cache_entry_t));
+
+    qff_font->glyph_cache[0].code_point  = code_point;
+    qff_font->glyph_cache[0].width       = width;
+    qff_font->glyph_cache[0].data_offset = data_offset;
+}
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
+static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+    uint8_t  glyph_width;
+    uint32_t data_offset;
+
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    if (!qp_drawtext_glyph_cache_get(qff_font, code_point, &glyph_width, &data_offset))
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    {
+        uint32_t glyph_value;
+        if (!qp_drawtext_lookup_glyph(qff_font, code_point, &glyph_value)) {
+            return false;
+        }
+
+        glyph_width = (uint8_t)(glyph_value & QFF_GLYPH_WIDTH_MASK);
+        data_offset = qff_font->glyph_data_offset + ((glyph_value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
+
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+        qp_drawtext_glyph_cache_put(qff_font, code_point, glyph_width, data_offset);
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    }
+
+    if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph data\n");
+        return false;
+    }
+
+    *width = glyph_width;
+    return true;
+}
+
 // Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
 static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const char *str, code_point_handler handler, void *cb_arg) {
     while (*str) {
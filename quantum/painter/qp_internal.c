@@ -85,6 +85,12 @@ void qp_internal_task(void) {
     void qp_internal_animation_tick(void);
     qp_internal_animation_tick();
 
+#ifdef QUANTUM_PAINTER_SURFACE_ENABLE
+    // Release displays once their non-blocking surface flushes have completed
+    void qp_surface_internal_async_tick(void);
+    qp_surface_internal_async_tick();
+#endif
+
 #ifdef QUANTUM_PAINTER_LVGL_INTEGRATION_ENABLE
     // Run LVGL ticks
     void qp_lvgl_internal_tick(void);
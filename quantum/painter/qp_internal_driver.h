@@ -17,6 +17,8 @@ typedef bool (*painter_driver_pixdata_func)(painter_device_t device, const void
 typedef bool (*painter_driver_convert_palette_func)(painter_device_t device, int16_t palette_size, qp_pixel_t *palette);
 typedef bool (*painter_driver_append_pixels)(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices);
 typedef bool (*painter_driver_append_pixdata)(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte);
+typedef bool (*painter_driver_append_packed)(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t bits_per_pixel, const uint8_t *packed_indices);
+typedef bool (*painter_driver_append_pixspan)(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, const uint8_t *pixdata, uint32_t byte_count);
 
 // Driver vtable definition
 typedef struct painter_driver_vtable_t {
@@ -29,6 +31,15 @@ typedef struct painter_driver_vtable_t {
     painter_driver_convert_palette_func palette_convert;
     painter_driver_append_pixels        append_pixels;
     painter_driver_append_pixdata       append_pixdata;
+
+    // Optional: starts streaming pixel data without waiting for the transfer, see qp_comms_send_async()
+    painter_driver_pixdata_func pixdata_async;
+
+    // Optional: bulk variant of append_pixels, taking palette indices still packed at bits_per_pixel (LSB first) as stored in QGF/QFF
+    painter_driver_append_packed append_packed;
+
+    // Optional: bulk variant of append_pixdata, copying a run of native pixel data bytes
+    painter_driver_append_pixspan append_pixspan;
 } painter_driver_vtable_t;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,12 +49,18 @@ typedef bool (*painter_driver_comms_init_func)(painter_device_t device);
 typedef bool (*painter_driver_comms_start_func)(painter_device_t device);
 typedef void (*painter_driver_comms_stop_func)(painter_device_t device);
 typedef uint32_t (*painter_driver_comms_send_func)(painter_device_t device, const void *data, uint32_t byte_count);
+typedef bool (*painter_driver_comms_send_async_func)(painter_device_t device, const void *data, uint32_t byte_count);
+typedef bool (*painter_driver_comms_send_async_complete_func)(painter_device_t device);
 
 typedef struct painter_comms_vtable_t {
     painter_driver_comms_init_func  comms_init;
     painter_driver_comms_start_func comms_start;
     painter_driver_comms_stop_func  comms_stop;
     painter_driver_comms_send_func  comms_send;
+
+    // Optional: non-blocking sends, which keep the bus started until they complete
+    painter_driver_comms_send_async_func          comms_send_async;
+    painter_driver_comms_send_async_complete_func comms_send_async_complete;
 } painter_comms_vtable_t;
 
 typedef void (*painter_driver_comms_send_command_func)(painter_device_t device, uint8_t cmd);
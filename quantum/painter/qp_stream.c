@@ -1,14 +1,32 @@
 // Copyright 2021 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
+
 #include "qp_stream.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Stream API
 
+static inline int16_t mem_get(qp_stream_t *stream);
+
 uint32_t qp_stream_read_impl(void *output_buf, uint32_t member_size, uint32_t num_members, qp_stream_t *stream) {
     uint8_t *output_ptr = (uint8_t *)output_buf;
 
+    // Memory streams can be copied directly, rather than going through get() for each byte
+    if (stream->get == mem_get) {
+        qp_memory_stream_t *s         = (qp_memory_stream_t *)stream;
+        uint32_t            requested = num_members * member_size;
+        uint32_t            available = s->position < s->length ? (uint32_t)(s->length - s->position) : 0;
+        uint32_t            count     = requested < available ? requested : available;
+        memcpy(output_ptr, &s->buffer[s->position], count);
+        s->position += count;
+        if (count < requested) {
+            s->is_eof = true;
+        }
+        return count / member_size;
+    }
+
     uint32_t i;
     for (i = 0; i < (num_members * member_size); ++i) {
         int16_t c = qp_stream_get(stream);
@@ -0,0 +1,412 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+
+// qp_surface.h pulls in the painter internals, which aren't C++-friendly
+painter_device_t qp_make_rgb565_surface(uint16_t panel_width, uint16_t panel_height, void *buffer);
+painter_device_t qp_make_mono1bpp_surface(uint16_t panel_width, uint16_t panel_height, void *buffer);
+painter_device_t qp_make_mock_rgb888_panel(uint16_t panel_width, uint16_t panel_height, void *framebuffer);
+}
+
+namespace {
+
+enum : uint8_t {
+    GRAYSCALE_1BPP = 0x00,
+    GRAYSCALE_2BPP = 0x01,
+    GRAYSCALE_4BPP = 0x02,
+    GRAYSCALE_8BPP = 0x03,
+    RGB565_16BPP   = 0x08,
+};
+
+enum : uint8_t {
+    UNCOMPRESSED = 0,
+    RLE          = 1,
+};
+
+constexpr uint16_t SMALL_SIZE = 64;
+
+uint16_t small_buffer[SMALL_SIZE * SMALL_SIZE];
+uint8_t  mono_buffer[SMALL_SIZE * SMALL_SIZE / 8];
+uint8_t  rgb888_buffer[SMALL_SIZE * SMALL_SIZE * 3];
+
+painter_device_t small_surface;
+painter_device_t mono_surface;
+painter_device_t rgb888_panel;
+
+void put_u16(std::vector<uint8_t> &out, uint16_t v) {
+    out.push_back(v & 0xFF);
+    out.push_back(v >> 8);
+}
+
+void put_u32(std::vector<uint8_t> &out, uint32_t v) {
+    put_u16(out, v & 0xFFFF);
+    put_u16(out, v >> 16);
+}
+
+void put_block_header(std::vector<uint8_t> &out, uint8_t type_id, uint32_t length) {
+    out.push_back(type_id);
+    out.push_back(~type_id);
+    out.push_back(length & 0xFF);
+    out.push_back((length >> 8) & 0xFF);
+    out.push_back((length >> 16) & 0xFF);
+}
+
+// QMK's RLE scheme: a marker below 128 repeats the next byte that many times, otherwise (marker - 127) literal bytes follow
+std::vector<uint8_t> rle_encode(const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> out;
+    size_t               i = 0;
+    while (i < data.size()) {
+        size_t run = 1;
+        while (i + run < data.size() && run < 127 && data[i + run] == data[i]) {
+            ++run;
+        }
+        if (run >= 3) {
+            out.push_back(run);
+            out.push_back(data[i]);
+            i += run;
+            continue;
+        }
+
+        size_t literal = 0;
+        while (i + literal < data.size() && literal < 128) {
+            if (i + literal + 2 < data.size() && data[i + literal] == data[i + literal + 1] && data[i + literal] == data[i + literal + 2]) {
+                break;
+            }
+            ++literal;
+        }
+        out.push_back(127 + literal);
+        out.insert(out.end(), data.begin() + i, data.begin() + i + literal);
+        i += literal;
+    }
+    return out;
+}
+
+// Builds a single-frame QGF image around the supplied pixel data
+std::vector<uint8_t> make_qgf(uint16_t width, uint16_t height, uint8_t format, uint8_t compression, const std::vector<uint8_t> &pixels) {
+    std::vector<uint8_t> data = compression == RLE ? rle_encode(pixels) : pixels;
+    std::vector<uint8_t> out;
+
+    const uint32_t frame_offset = 23 + 9;
+    const uint32_t total_size   = frame_offset + 11 + 5 + data.size();
+
+    put_block_header(out, 0x00, 18);
+    out.insert(out.end(), {0x51, 0x47, 0x46, 0x01});
+    put_u32(out, total_size);
+    put_u32(out, ~total_size);
+    put_u16(out, width);
+    put_u16(out, height);
+    put_u16(out, 1);
+
+    put_block_header(out, 0x01, 4);
+    put_u32(out, frame_offset);
+
+    put_block_header(out, 0x02, 6);
+    out.insert(out.end(), {format, 0x00, compression, 0x00});
+    put_u16(out, 0);
+
+    put_block_header(out, 0x05, data.size());
+    out.insert(out.end(), data.begin(), data.end());
+    return out;
+}
+
+// Generates palette indices with a mix of flat areas and noise, so that RLE gets both kinds of run
+std::vector<uint8_t> make_indices(uint32_t count, uint8_t bpp, uint32_t seed) {
+    std::vector<uint8_t> indices(count);
+    const uint8_t        mask = (1 << bpp) - 1;
+    for (uint32_t i = 0; i < count; ++i) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        indices[i] = ((i / 97) % 2) ? (uint8_t)((i / 97) & mask) : (uint8_t)(seed & mask);
+    }
+    return indices;
+}
+
+std::vector<uint8_t> pack_indices(const std::vector<uint8_t> &indices, uint8_t bpp) {
+    const uint8_t        pixels_per_byte = 8 / bpp;
+    std::vector<uint8_t> packed((indices.size() + pixels_per_byte - 1) / pixels_per_byte, 0);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        packed[i / pixels_per_byte] |= indices[i] << ((i % pixels_per_byte) * bpp);
+    }
+    return packed;
+}
+
+// Byte-swapped RGB565 of the grayscale palette entry the default white-on-black recolor produces
+uint16_t expected_rgb565(uint8_t index, uint8_t bpp) {
+    uint8_t  v      = 255 * index / ((1 << bpp) - 1);
+    uint16_t rgb565 = ((v >> 3) << 11) | ((v >> 2) << 5) | (v >> 3);
+    return __builtin_bswap16(rgb565);
+}
+
+// A font glyph, drawn from a 1bpp image of the font's line height
+struct Glyph {
+    uint32_t             code_point;
+    uint8_t              width;
+    std::vector<uint8_t> indices;
+};
+
+constexpr uint8_t FONT_HEIGHT      = 5;
+constexpr uint8_t GLYPH_WIDTH_BITS = 6; // QFF packs the glyph's data offset above its width
+
+Glyph make_glyph(uint32_t code_point, uint8_t width) {
+    return {code_point, width, make_indices(width * FONT_HEIGHT, 1, code_point * 2654435761u)};
+}
+
+// Builds an uncompressed 1bpp QFF with only a unicode glyph table, in the order given
+std::vector<uint8_t> make_qff(const std::vector<Glyph> &glyphs) {
+    std::vector<uint8_t> table;
+    std::vector<uint8_t> data;
+    for (const Glyph &glyph : glyphs) {
+        uint32_t value = (data.size() << GLYPH_WIDTH_BITS) | glyph.width;
+        table.insert(table.end(), {(uint8_t)glyph.code_point, (uint8_t)(glyph.code_point >> 8), (uint8_t)(glyph.code_point >> 16)});
+        table.insert(table.end(), {(uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16)});
+        auto packed = pack_indices(glyph.indices, 1);
+        data.insert(data.end(), packed.begin(), packed.end());
+    }
+
+    const uint32_t       total_size = 25 + 5 + table.size() + 5 + data.size();
+    std::vector<uint8_t> out;
+
+    put_block_header(out, 0x00, 20);
+    out.insert(out.end(), {0x51, 0x46, 0x46, 0x01});
+    put_u32(out, total_size);
+    put_u32(out, ~total_size);
+    out.push_back(FONT_HEIGHT);
+    out.push_back(0); // no ascii table
+    put_u16(out, glyphs.size());
+    out.insert(out.end(), {GRAYSCALE_1BPP, 0x00, UNCOMPRESSED, 0x00});
+
+    put_block_header(out, 0x02, table.size());
+    out.insert(out.end(), table.begin(), table.end());
+
+    put_block_header(out, 0x04, data.size());
+    out.insert(out.end(), data.begin(), data.end());
+    return out;
+}
+
+// Rewrites the width in the glyph table entry at the specified index, leaving the pixel data alone
+void set_table_width(std::vector<uint8_t> &qff, size_t index, uint8_t width) {
+    uint8_t &value = qff[25 + 5 + index * 6 + 3];
+    value          = (value & ~((1 << GLYPH_WIDTH_BITS) - 1)) | width;
+}
+
+} // namespace
+
+class QpCodec : public ::testing::TestWithParam<std::tuple<uint8_t, uint8_t>> {
+   protected:
+    static void SetUpTestSuite() {
+        if (!small_surface) {
+            small_surface = qp_make_rgb565_surface(SMALL_SIZE, SMALL_SIZE, small_buffer);
+            mono_surface  = qp_make_mono1bpp_surface(SMALL_SIZE, SMALL_SIZE, mono_buffer);
+            rgb888_panel  = qp_make_mock_rgb888_panel(SMALL_SIZE, SMALL_SIZE, rgb888_buffer);
+            ASSERT_TRUE(qp_init(small_surface, QP_ROTATION_0));
+            ASSERT_TRUE(qp_init(mono_surface, QP_ROTATION_0));
+            ASSERT_TRUE(qp_init(rgb888_panel, QP_ROTATION_0));
+        }
+    }
+
+    void SetUp() override {
+        memset(small_buffer, 0, sizeof(small_buffer));
+        memset(mono_buffer, 0, sizeof(mono_buffer));
+        memset(rgb888_buffer, 0, sizeof(rgb888_buffer));
+    }
+};
+
+TEST_P(QpCodec, DecodesPaletteImage) {
+    const uint8_t  format      = std::get<0>(GetParam());
+    const uint8_t  compression = std::get<1>(GetParam());
+    const uint8_t  bpp         = 1 << format;
+    const uint16_t width       = 37; // odd sizes, so rows don't line up with bytes
+    const uint16_t height      = 29;
+    const uint16_t x           = 3;
+    const uint16_t y           = 5;
+
+    auto indices = make_indices(width * height, bpp, 0x12345678);
+    auto qgf     = make_qgf(width, height, format, compression, pack_indices(indices, bpp));
+
+    painter_image_handle_t image = qp_load_image_mem(qgf.data());
+    ASSERT_NE(image, nullptr);
+    ASSERT_TRUE(qp_drawimage(small_surface, x, y, image));
+    qp_close_image(image);
+
+    for (uint16_t row = 0; row < SMALL_SIZE; ++row) {
+        for (uint16_t col = 0; col < SMALL_SIZE; ++col) {
+            uint16_t expected = 0;
+            if (row >= y && row < y + height && col >= x && col < x + width) {
+                expected = expected_rgb565(indices[(row - y) * width + (col - x)], bpp);
+            }
+            ASSERT_EQ(small_buffer[row * SMALL_SIZE + col], expected) << "at " << col << "," << row;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Formats, QpCodec, ::testing::Combine(::testing::Values(GRAYSCALE_1BPP, GRAYSCALE_2BPP, GRAYSCALE_4BPP, GRAYSCALE_8BPP), ::testing::Values(UNCOMPRESSED, RLE)));
+
+TEST_F(QpCodec, DecodesNativeImage) {
+    for (uint8_t compression : {UNCOMPRESSED, RLE}) {
+        const uint16_t width  = 41;
+        const uint16_t height = 33;
+
+        std::vector<uint8_t> pixels = make_indices(width * height * 2, 8, 0xCAFEF00D);
+        auto                 qgf    = make_qgf(width, height, RGB565_16BPP, compression, pixels);
+
+        memset(small_buffer, 0, sizeof(small_buffer));
+        painter_image_handle_t image = qp_load_image_mem(qgf.data());
+        ASSERT_NE(image, nullptr);
+        ASSERT_TRUE(qp_drawimage(small_surface, 0, 0, image));
+        qp_close_image(image);
+
+        for (uint16_t row = 0; row < height; ++row) {
+            ASSERT_EQ(memcmp(&small_buffer[row * SMALL_SIZE], &pixels[row * width * 2], width * 2), 0) << "row " << row;
+        }
+    }
+}
+
+TEST_F(QpCodec, DecodesWithoutDriverBulkSupport) {
+    // The mono surface doesn't provide append_packed, so this exercises the generic path
+    const uint16_t width  = 50;
+    const uint16_t height = 20;
+
+    auto indices = make_indices(width * height, 1, 0xDEADBEEF);
+    auto qgf     = make_qgf(width, height, GRAYSCALE_1BPP, RLE, pack_indices(indices, 1));
+
+    painter_image_handle_t image = qp_load_image_mem(qgf.data());
+    ASSERT_NE(image, nullptr);
+    ASSERT_TRUE(qp_drawimage(mono_surface, 0, 0, image));
+    qp_close_image(image);
+
+    for (uint16_t row = 0; row < height; ++row) {
+        for (uint16_t col = 0; col < width; ++col) {
+            uint32_t pixel = row * SMALL_SIZE + col;
+            ASSERT_EQ((mono_buffer[pixel / 8] >> (pixel % 8)) & 1, indices[row * width + col]) << "at " << col << "," << row;
+        }
+    }
+}
+
+TEST_F(QpCodec, DecodesOnRgb888Panel) {
+    // 24bpp leaves room for 341 pixels in the pixdata buffer, so the buffer fills part-way through a packed byte
+    const uint16_t width  = 37;
+    const uint16_t height = 29;
+
+    for (uint8_t format : {GRAYSCALE_1BPP, GRAYSCALE_2BPP, GRAYSCALE_4BPP}) {
+        for (uint8_t compression : {UNCOMPRESSED, RLE}) {
+            const uint8_t bpp     = 1 << format;
+            auto          indices = make_indices(width * height, bpp, 0x600DCAFE);
+            auto          qgf     = make_qgf(width, height, format, compression, pack_indices(indices, bpp));
+
+            memset(rgb888_buffer, 0, sizeof(rgb888_buffer));
+            painter_image_handle_t image = qp_load_image_mem(qgf.data());
+            ASSERT_NE(image, nullptr);
+            ASSERT_TRUE(qp_drawimage(rgb888_panel, 0, 0, image));
+            qp_close_image(image);
+
+            for (uint16_t row = 0; row < height; ++row) {
+                for (uint16_t col = 0; col < width; ++col) {
+                    const uint8_t *pixel = &rgb888_buffer[(row * SMALL_SIZE + col) * 3];
+                    const uint8_t  v     = 255 * indices[row * width + col] / ((1 << bpp) - 1);
+                    ASSERT_EQ(pixel[0], v) << "bpp " << (int)bpp << " at " << col << "," << row;
+                    ASSERT_EQ(pixel[1], v) << "bpp " << (int)bpp << " at " << col << "," << row;
+                    ASSERT_EQ(pixel[2], v) << "bpp " << (int)bpp << " at " << col << "," << row;
+                }
+            }
+        }
+    }
+}
+
+namespace {
+
+// Greek alpha to delta, encoded as UTF-8
+const char *const ALPHA = "α";
+const char *const BETA  = "β";
+const char *const GAMMA = "γ";
+
+const std::vector<Glyph> greek_glyphs = {make_glyph(0x3B1, 3), make_glyph(0x3B2, 5), make_glyph(0x3B3, 7), make_glyph(0x3B4, 9)};
+
+} // namespace
+
+TEST_F(QpCodec, TextWidthFromUnicodeTable) {
+    std::vector<Glyph> unsorted = {greek_glyphs[2], greek_glyphs[0], greek_glyphs[3], greek_glyphs[1]};
+
+    // Sorted tables are binary-searched, unsorted ones scanned, and both must agree
+    for (const auto &glyphs : {greek_glyphs, unsorted}) {
+        auto qff = make_qff(glyphs);
+
+        painter_font_handle_t font = qp_load_font_mem(qff.data());
+        ASSERT_NE(font, nullptr);
+        EXPECT_EQ(qp_textwidth(font, ALPHA), 3);
+        EXPECT_EQ(qp_textwidth(font, "δγβα"), 9 + 7 + 5 + 3);
+        EXPECT_EQ(qp_textwidth(font, "ααδα"), 3 + 3 + 9 + 3);
+        EXPECT_EQ(qp_textwidth(font, "ε"), 0); // not in the font
+        EXPECT_EQ(qp_textwidth(font, "a"), 0);
+        qp_close_font(font);
+    }
+}
+
+TEST_F(QpCodec, DrawsTextFromUnicodeTable) {
+    auto qff = make_qff(greek_glyphs);
+
+    painter_font_handle_t font = qp_load_font_mem(qff.data());
+    ASSERT_NE(font, nullptr);
+    // The repeated alpha comes from the glyph cache
+    ASSERT_EQ(qp_drawtext(small_surface, 0, 0, font, "αδα"), 3 + 9 + 3);
+    qp_close_font(font);
+
+    uint16_t x = 0;
+    for (const Glyph *glyph : {&greek_glyphs[0], &greek_glyphs[3], &greek_glyphs[0]}) {
+        for (uint16_t row = 0; row < FONT_HEIGHT; ++row) {
+            for (uint16_t col = 0; col < glyph->width; ++col) {
+                ASSERT_EQ(small_buffer[row * SMALL_SIZE + x + col], expected_rgb565(glyph->indices[row * glyph->width + col], 1)) << "at " << x + col << "," << row;
+            }
+        }
+        x += glyph->width;
+    }
+}
+
+TEST_F(QpCodec, GlyphCacheHitsSkipTheTable) {
+    auto qff = make_qff(greek_glyphs);
+
+    painter_font_handle_t font = qp_load_font_mem(qff.data());
+    ASSERT_NE(font, nullptr);
+    EXPECT_EQ(qp_textwidth(font, ALPHA), 3);
+
+    // A cached glyph is no longer read from the table...
+    set_table_width(qff, 0, 1);
+    EXPECT_EQ(qp_textwidth(font, ALPHA), 3);
+    // ...but one that misses is
+    set_table_width(qff, 1, 1);
+    EXPECT_EQ(qp_textwidth(font, BETA), 1);
+
+    // Reloading the font starts with an empty cache
+    qp_close_font(font);
+    font = qp_load_font_mem(qff.data());
+    ASSERT_NE(font, nullptr);
+    EXPECT_EQ(qp_textwidth(font, ALPHA), 1);
+    qp_close_font(font);
+}
+
+TEST_F(QpCodec, GlyphCacheEvictsLeastRecentlyUsed) {
+    static_assert(QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE == 2, "test assumes a two entry cache");
+    auto qff = make_qff(greek_glyphs);
+
+    painter_font_handle_t font = qp_load_font_mem(qff.data());
+    ASSERT_NE(font, nullptr);
+    EXPECT_EQ(qp_textwidth(font, ALPHA), 3);
+    EXPECT_EQ(qp_textwidth(font, BETA), 5);
+
+    // From here on, only cached glyphs report their real width
+    for (size_t i = 0; i < greek_glyphs.size(); ++i) {
+        set_table_width(qff, i, 1);
+    }
+
+    EXPECT_EQ(qp_textwidth(font, ALPHA), 3); // hit, alpha becomes most recently used
+    EXPECT_EQ(qp_textwidth(font, GAMMA), 1); // miss, evicting beta
+    EXPECT_EQ(qp_textwidth(font, ALPHA), 3); // still cached
+    EXPECT_EQ(qp_textwidth(font, BETA), 1);  // evicted, so read from the table again
+    qp_close_font(font);
+}
@@ -0,0 +1,77 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "qp_internal.h"
+#include "qp_comms_dummy.h"
+#include "qp_tft_panel.h"
+
+// An RGB888 panel whose GRAM is a framebuffer in RAM. Pixel conversion and packing use the TFT panel helpers, as the
+// ILI9488 does; only the transport to the panel is mocked.
+
+typedef struct mock_panel_device_t {
+    painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
+
+    uint8_t *framebuffer;
+    uint16_t left, top, right, bottom;
+    uint16_t x, y;
+} mock_panel_device_t;
+
+static mock_panel_device_t mock_panel;
+
+static bool mock_panel_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+static bool mock_panel_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    mock_panel_device_t *panel = (mock_panel_device_t *)device;
+    panel->left                = left;
+    panel->top                 = top;
+    panel->right               = right;
+    panel->bottom              = bottom;
+    panel->x                   = left;
+    panel->y                   = top;
+    return true;
+}
+
+// Writes the pixels into the current viewport, wrapping at its right edge like a real panel's GRAM
+static bool mock_panel_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    mock_panel_device_t *panel = (mock_panel_device_t *)device;
+    const uint8_t *      pixel = (const uint8_t *)pixel_data;
+    for (uint32_t i = 0; i < native_pixel_count; ++i) {
+        if (panel->y > panel->bottom) {
+            return false;
+        }
+        memcpy(&panel->framebuffer[(panel->y * panel->base.panel_width + panel->x) * 3], pixel, 3);
+        pixel += 3;
+        if (++panel->x > panel->right) {
+            panel->x = panel->left;
+            panel->y++;
+        }
+    }
+    return true;
+}
+
+static const painter_driver_vtable_t mock_panel_driver_vtable = {
+    .init            = mock_panel_init,
+    .power           = qp_tft_panel_power,
+    .clear           = qp_tft_panel_clear,
+    .flush           = qp_tft_panel_flush,
+    .viewport        = mock_panel_viewport,
+    .pixdata         = mock_panel_pixdata,
+    .palette_convert = qp_tft_panel_palette_convert_rgb888,
+    .append_pixels   = qp_tft_panel_append_pixels_rgb888,
+    .append_pixdata  = qp_tft_panel_append_pixdata,
+    .append_packed   = qp_tft_panel_append_packed_rgb888,
+    .append_pixspan  = qp_tft_panel_append_pixspan,
+};
+
+painter_device_t qp_make_mock_rgb888_panel(uint16_t panel_width, uint16_t panel_height, void *framebuffer) {
+    mock_panel.base.driver_vtable         = &mock_panel_driver_vtable;
+    mock_panel.base.comms_vtable          = &dummy_comms_vtable;
+    mock_panel.base.native_bits_per_pixel = 24;
+    mock_panel.base.panel_width           = panel_width;
+    mock_panel.base.panel_height          = panel_height;
+    mock_panel.base.rotation              = QP_ROTATION_0;
+    mock_panel.framebuffer                = (uint8_t *)framebuffer;
+    return (painter_device_t)&mock_panel;
+}
@@ -0,0 +1,41 @@
+qp_codec_DEFS := \
+	-DTRUE=1 -DFALSE=0 \
+	-DEEPROM_TEST_HARNESS \
+	-DQUANTUM_PAINTER_ENABLE \
+	-DQUANTUM_PAINTER_SURFACE_ENABLE \
+	-DQUANTUM_PAINTER_DUMMY_COMMS_ENABLE \
+	-DQUANTUM_PAINTER_SUPPORTS_256_PALETTE=TRUE \
+	-DQUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS=TRUE \
+	-DQUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE=2 \
+	-DSURFACE_NUM_DEVICES=3
+qp_codec_INC := \
+	$(QUANTUM_PATH)/painter \
+	$(QUANTUM_PATH)/unicode \
+	$(DRIVER_PATH)/painter/comms \
+	$(DRIVER_PATH)/painter/generic \
+	$(DRIVER_PATH)/painter/tft_panel
+qp_codec_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/unicode/utf8.c \
+	$(QUANTUM_PATH)/deferred_exec.c \
+	$(QUANTUM_PATH)/painter/qp.c \
+	$(QUANTUM_PATH)/painter/qp_stream.c \
+	$(QUANTUM_PATH)/painter/qgf.c \
+	$(QUANTUM_PATH)/painter/qff.c \
+	$(QUANTUM_PATH)/painter/qp_draw_core.c \
+	$(QUANTUM_PATH)/painter/qp_draw_codec.c \
+	$(QUANTUM_PATH)/painter/qp_draw_image.c \
+	$(QUANTUM_PATH)/painter/qp_draw_text.c \
+	$(QUANTUM_PATH)/painter/qp_comms.c \
+	$(DRIVER_PATH)/painter/comms/qp_comms_dummy.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_common.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_mono1bpp.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_rgb565.c \
+	$(DRIVER_PATH)/painter/tft_panel/qp_tft_panel.c \
+	$(QUANTUM_PATH)/painter/tests/qp_mock_panel.c \
+	$(QUANTUM_PATH)/painter/tests/qp_codec_tests.cpp
+
+qp_codec_bytewise_DEFS := $(qp_codec_DEFS) -DQUANTUM_PAINTER_BULK_DECODE=FALSE
+qp_codec_bytewise_INC := $(qp_codec_INC)
+qp_codec_bytewise_SRC := $(qp_codec_SRC)
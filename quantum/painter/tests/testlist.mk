@@ -0,0 +1,3 @@
+TEST_LIST += \
+	qp_codec \
+	qp_codec_bytewise
@@ -16,6 +16,7 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#include <string.h>
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
@@ -80,7 +81,18 @@ __attribute__((weak)) bool combo_should_trigger(uint16_t combo_index, combo_t *c
 typedef enum { COMBO_KEY_NOT_PRESSED, COMBO_KEY_PRESSED, COMBO_KEY_REPRESSED } combo_key_action_t;
 
 #ifndef COMBO_NO_TIMER
+#    ifdef KEYEVENT_TIME_US
+/* The combo timer runs off the key events' microsecond timestamps. */
+static uint32_t timer = 0;
+#        define COMBO_TIMER_START(record) ((record)->event.time_us)
+#        define COMBO_TIMER_EXCEEDED_AT(record, term) (TIMER_DIFF_32((record)->event.time_us, timer) > (uint32_t)(term) * 1000)
+#        define COMBO_TIMER_EXCEEDED(term) (timer_elapsed_us(timer) > (uint32_t)(term) * 1000)
+#    else
 static uint16_t timer = 0;
+#        define COMBO_TIMER_START(record) timer_read()
+#        define COMBO_TIMER_EXCEEDED_AT(record, term) (timer_elapsed(timer) > (term))
+#        define COMBO_TIMER_EXCEEDED(term) (timer_elapsed(timer) > (term))
+#    endif
 #endif
 static bool     b_combo_enable = true; // defaults to enabled
 static uint16_t longest_term   = 0;
@@ -102,6 +114,19 @@ static queued_combo_t combo_buffer[COMBO_BUFFER_LENGTH];
 
 #define INCREMENT_MOD(i) i = (i + 1) % COMBO_BUFFER_LENGTH
 
+#ifdef COMBO_INDEX_LENGTH
+/* Keycode to combo lookup table, sorted by keycode and then by combo index,
+ * so that an event only visits the combos it is part of, in the same order
+ * as a linear scan would. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+} combo_index_entry_t;
+static combo_index_entry_t combo_key_index[COMBO_INDEX_LENGTH];
+static uint16_t            combo_index_size  = 0;
+static bool                combo_index_valid = false;
+#endif
+
 #ifndef EXTRA_SHORT_COMBOS
 /* flags are their own elements in combo_t struct. */
 #    define COMBO_ACTIVE(combo) (combo->active)
@@ -455,7 +480,7 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
 
 #ifndef COMBO_NO_TIMER
             /* Don't buffer this combo if its combo term has passed. */
-            if (timer && timer_elapsed(timer) > time) {
+            if (timer && COMBO_TIMER_EXCEEDED_AT(record, time)) {
                 DISABLE_COMBO(combo);
                 return COMBO_KEY_PRESSED;
             } else
@@ -551,9 +576,63 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
     return key_is_part_of_combo ? COMBO_KEY_PRESSED : COMBO_KEY_NOT_PRESSED;
 }
 
+#ifdef COMBO_INDEX_LENGTH
+void combo_index_rebuild(void) {
+    combo_index_size  = 0;
+    combo_index_valid = false;
+
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        combo_t *combo = combo_get(idx);
+        uint16_t key;
+        for (uint8_t i = 0; (key = pgm_read_word(&combo->keys[i])) != COMBO_END; ++i) {
+            if (combo_index_size >= COMBO_INDEX_LENGTH) {
+                // Table too small, fall back to the linear scan.
+                return;
+            }
+
+            /* Insertion sort; only shifting strictly greater keycodes keeps
+             * entries of equal keycode in combo order. A key listed twice in
+             * the same combo only needs one entry. */
+            uint16_t pos = combo_index_size;
+            while (pos > 0 && combo_key_index[pos - 1].keycode > key) {
+                --pos;
+            }
+            if (pos > 0 && combo_key_index[pos - 1].keycode == key && combo_key_index[pos - 1].combo_index == idx) {
+                continue;
+            }
+            memmove(&combo_key_index[pos + 1], &combo_key_index[pos], (combo_index_size - pos) * sizeof(combo_index_entry_t));
+            combo_key_index[pos] = (combo_index_entry_t){
+                .keycode     = key,
+                .combo_index = idx,
+            };
+            ++combo_index_size;
+        }
+    }
+    combo_index_valid = true;
+}
+
+static uint16_t combo_index_lower_bound(uint16_t keycode) {
+    uint16_t lo = 0, hi = combo_index_size;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (combo_key_index[mid].keycode < keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+#endif
+
+void combo_init(void) {
+#ifdef COMBO_INDEX_LENGTH
+    combo_index_rebuild();
+#endif
+}
+
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    uint8_t is_combo_key          = COMBO_KEY_NOT_PRESSED;
-    bool    no_combo_keys_pressed = true;
+    uint8_t is_combo_key = COMBO_KEY_NOT_PRESSED;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -581,10 +660,19 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_INDEX_LENGTH
+    if (combo_index_valid) {
+        for (uint16_t i = combo_index_lower_bound(keycode); i < combo_index_size && combo_key_index[i].keycode == keycode; ++i) {
+            uint16_t idx = combo_key_index[i].combo_index;
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -592,10 +680,10 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
 #    ifdef COMBO_STRICT_TIMER
         if (!timer) {
             // timer is set only on the first key
-            timer = timer_read();
+            timer = COMBO_TIMER_START(record);
         }
 #    else
-        timer = timer_read();
+        timer = COMBO_TIMER_START(record);
 #    endif
 #endif
 
@@ -633,7 +721,7 @@ void combo_task(void) {
     }
 
 #ifndef COMBO_NO_TIMER
-    if (timer && timer_elapsed(timer) > longest_term) {
+    if (timer && COMBO_TIMER_EXCEEDED(longest_term)) {
         if (combo_buffer_read != combo_buffer_write) {
             apply_combos();
             longest_term = 0;
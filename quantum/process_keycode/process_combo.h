@@ -73,6 +73,7 @@ typedef struct combo_t {
 /* check if keycode is only modifiers */
 #define KEYCODE_IS_MOD(code) (IS_MODIFIER_KEYCODE(code) || (IS_QK_MODS(code) && !QK_MODS_GET_BASIC_KEYCODE(code)))
 
+void combo_init(void);
 bool process_combo(uint16_t keycode, keyrecord_t *record);
 void combo_task(void);
 void process_combo_event(uint16_t combo_index, bool pressed);
@@ -81,3 +82,7 @@ void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#ifdef COMBO_INDEX_LENGTH
+void combo_index_rebuild(void);
+#endif
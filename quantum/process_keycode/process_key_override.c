@@ -16,6 +16,7 @@
  */
 
 #include "process_key_override.h"
+#include <string.h>
 #include "report.h"
 #include "timer.h"
 #include "debug.h"
@@ -84,6 +85,20 @@ static uint16_t deferred_register = 0;
 // TODO: in future maybe save in EEPROM?
 static bool enabled = true;
 
+#ifdef KEY_OVERRIDE_INDEX_LENGTH
+/* Trigger keycode to override lookup table, sorted by trigger and then by
+ * override index. Overrides without a trigger (mod-only) sort first, under
+ * KC_NO. */
+typedef struct {
+    uint16_t trigger;
+    uint16_t override_index;
+} key_override_index_entry_t;
+static key_override_index_entry_t key_override_index[KEY_OVERRIDE_INDEX_LENGTH];
+static uint16_t                   key_override_index_size  = 0;
+static bool                       key_override_index_built = false;
+static bool                       key_override_index_valid = false;
+#endif
+
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
@@ -243,152 +258,255 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
-/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
-static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
-    if (key_override_count() == 0) {
-        return true;
+/** Tries activating a single override. Returns true if it activated, in which case `send_key_action` is set to whether the key action for `keycode` should be sent */
+static bool try_activating_single_override(const key_override_t *const override, const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *send_key_action) {
+    // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
+    if (active_mods == 0 && override->trigger_mods != 0) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
     }
 
-    for (uint8_t i = 0; i < key_override_count(); i++) {
-        const key_override_t *const override = key_override_get(i);
+    // Check layer
+    if ((override->layers & (1 << layer)) == 0) {
+        key_override_printf("Not activating override: Not set to activate on pressed layer\n");
+        return false;
+    }
 
-        // End of array
-        if (override == NULL) {
-            break;
-        }
+    // Check allowed activation events
+    if (!check_activation_event(override, key_down, is_mod)) {
+        key_override_printf("Not activating override: Activation event not allowed\n");
+        return false;
+    }
 
-        // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
-        if (active_mods == 0 && override->trigger_mods != 0) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    const bool is_trigger = override->trigger == keycode;
 
-        // Check layer
-        if ((override->layers & (1 << layer)) == 0) {
-            key_override_printf("Not activating override: Not set to activate on pressed layer\n");
-            continue;
-        }
+    // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
+    if (is_trigger && !key_down) {
+        key_override_printf("Not activating override: Trigger lifted\n");
+        return false;
+    }
 
-        // Check allowed activation events
-        if (!check_activation_event(override, key_down, is_mod)) {
-            key_override_printf("Not activating override: Activation event not allowed\n");
-            continue;
-        }
+    // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
+    const bool no_trigger = override->trigger == KC_NO;
 
-        const bool is_trigger = override->trigger == keycode;
+    // Check if aleady active
+    if (override == active_override) {
+        key_override_printf("Not activating override: Alerady actived\n");
+        return false;
+    }
 
-        // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
-        if (is_trigger && !key_down) {
-            key_override_printf("Not activating override: Trigger lifted\n");
-            continue;
-        }
+    // Check if enabled
+    if (override->enabled != NULL && !((*(override->enabled) & 1))) {
+        key_override_printf("Not activating override: Not enabled\n");
+        return false;
+    }
 
-        // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
-        const bool no_trigger = override->trigger == KC_NO;
+    // Check mods precisely
+    if (!key_override_matches_active_modifiers(override, active_mods)) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
+    }
 
-        // Check if aleady active
-        if (override == active_override) {
-            key_override_printf("Not activating override: Alerady actived\n");
-            continue;
-        }
+    // Check if trigger key is down.
+    const bool trigger_down = is_trigger && key_down;
 
-        // Check if enabled
-        if (override->enabled != NULL && !((*(override->enabled) & 1))) {
-            key_override_printf("Not activating override: Not enabled\n");
-            continue;
-        }
+    // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
+    // If no trigger key is required, yes.
+    // If the trigger was just pressed, yes.
+    // If the last non-mod key that was pressed down is the trigger key, yes.
+    bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
 
-        // Check mods precisely
-        if (!key_override_matches_active_modifiers(override, active_mods)) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    if (!should_activate) {
+        key_override_printf("Not activating override. Trigger not down\n");
+        return false;
+    }
 
-        // Check if trigger key is down.
-        const bool trigger_down = is_trigger && key_down;
+    key_override_printf("Activating override\n");
 
-        // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
-        // If no trigger key is required, yes.
-        // If the trigger was just pressed, yes.
-        // If the last non-mod key that was pressed down is the trigger key, yes.
-        bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
+    clear_active_override(false);
 
-        if (!should_activate) {
-            key_override_printf("Not activating override. Trigger not down\n");
-            continue;
-        }
+#ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
+    // Send a dummy keycode before unregistering the modifier(s)
+    // so that suppressing the modifier(s) doesn't falsely get interpreted
+    // by the host OS as a tap of a modifier key.
+    // For example, unintended activations of the start menu on Windows when
+    // using a GUI+<kc> key override with suppressed mods.
+    neutralize_flashing_modifiers(active_mods);
+#endif
 
-        key_override_printf("Activating override\n");
+    active_override                 = override;
+    active_override_trigger_is_down = true;
 
-        clear_active_override(false);
+    set_suppressed_override_mods(override->suppressed_mods);
 
-#ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
-        // Send a dummy keycode before unregistering the modifier(s)
-        // so that suppressing the modifier(s) doesn't falsely get interpreted
-        // by the host OS as a tap of a modifier key.
-        // For example, unintended activations of the start menu on Windows when
-        // using a GUI+<kc> key override with suppressed mods.
-        neutralize_flashing_modifiers(active_mods);
-#endif
+    if (!trigger_down && !no_trigger) {
+        // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
+        if (IS_BASIC_KEYCODE(override->trigger)) {
+            del_key(override->trigger);
+        } else {
+            unregister_code(override->trigger);
+        }
+    }
+
+    const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
 
-        active_override                 = override;
-        active_override_trigger_is_down = true;
+    bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
+                                mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
 
-        set_suppressed_override_mods(override->suppressed_mods);
+    // Try firing the custom handler
+    if (override->custom_action != NULL) {
+        register_replacement &= override->custom_action(true, override->context);
+    }
 
-        if (!trigger_down && !no_trigger) {
-            // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
-            if (IS_BASIC_KEYCODE(override->trigger)) {
-                del_key(override->trigger);
+    if (register_replacement) {
+        const uint8_t override_mods = extract_mod_bits(override->replacement);
+        set_weak_override_mods(override_mods);
+
+        // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
+        if (is_mod) {
+            key_override_printf("Deferring register replacement key\n");
+            schedule_deferred_register(mod_free_replacement);
+            send_keyboard_report();
+        } else {
+            if (IS_BASIC_KEYCODE(mod_free_replacement)) {
+                add_key(mod_free_replacement);
             } else {
-                unregister_code(override->trigger);
+                key_override_printf("NOT KEY 2\n");
+                send_keyboard_report();
+                // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
+                wait_ms(10);
+                register_code(mod_free_replacement);
             }
         }
+    } else {
+        // If not registering the replacement key send keyboard report to update the unregistered keys.
+        send_keyboard_report();
+    }
+
+    // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
+    *send_key_action = !trigger_down;
+    return true;
+}
 
-        const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
+#ifdef KEY_OVERRIDE_INDEX_LENGTH
+void key_override_index_rebuild(void) {
+    key_override_index_size  = 0;
+    key_override_index_built = true;
+    key_override_index_valid = false;
 
-        bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
-                                    mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+    for (uint16_t idx = 0; idx < key_override_count(); ++idx) {
+        const key_override_t *const override = key_override_get(idx);
 
-        // Try firing the custom handler
-        if (override->custom_action != NULL) {
-            register_replacement &= override->custom_action(true, override->context);
+        // End of array
+        if (override == NULL) {
+            break;
         }
 
-        if (register_replacement) {
-            const uint8_t override_mods = extract_mod_bits(override->replacement);
-            set_weak_override_mods(override_mods);
+        if (key_override_index_size >= KEY_OVERRIDE_INDEX_LENGTH) {
+            // Table too small, fall back to the linear scan.
+            return;
+        }
 
-            // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
-            if (is_mod) {
-                key_override_printf("Deferring register replacement key\n");
-                schedule_deferred_register(mod_free_replacement);
-                send_keyboard_report();
-            } else {
-                if (IS_BASIC_KEYCODE(mod_free_replacement)) {
-                    add_key(mod_free_replacement);
-                } else {
-                    key_override_printf("NOT KEY 2\n");
-                    send_keyboard_report();
-                    // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
-                    wait_ms(10);
-                    register_code(mod_free_replacement);
-                }
-            }
+        // Insertion sort; only shifting strictly greater triggers keeps entries of equal trigger in override order.
+        uint16_t pos = key_override_index_size;
+        while (pos > 0 && key_override_index[pos - 1].trigger > override->trigger) {
+            --pos;
+        }
+        memmove(&key_override_index[pos + 1], &key_override_index[pos], (key_override_index_size - pos) * sizeof(key_override_index_entry_t));
+        key_override_index[pos] = (key_override_index_entry_t){
+            .trigger        = override->trigger,
+            .override_index = idx,
+        };
+        ++key_override_index_size;
+    }
+    key_override_index_valid = true;
+}
+
+static uint16_t key_override_index_lower_bound(uint16_t trigger) {
+    uint16_t lo = 0, hi = key_override_index_size;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (key_override_index[mid].trigger < trigger) {
+            lo = mid + 1;
         } else {
-            // If not registering the replacement key send keyboard report to update the unregistered keys.
-            send_keyboard_report();
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/** Only an override without a trigger, triggered by `keycode`, or triggered by the last key pressed down can activate. Visits those in the same order as the linear scan by merging their entries in the index. */
+static bool try_activating_indexed_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *send_key_action) {
+    const uint16_t triggers[] = {KC_NO, keycode, last_key_down};
+    uint16_t       next[ARRAY_SIZE(triggers)];
+    uint16_t       end[ARRAY_SIZE(triggers)];
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(triggers); ++i) {
+        next[i] = end[i] = 0;
+        if ((i > 0 && triggers[i] == KC_NO) || (i > 1 && triggers[i] == triggers[1])) {
+            continue;
+        }
+        next[i] = end[i] = key_override_index_lower_bound(triggers[i]);
+        while (end[i] < key_override_index_size && key_override_index[end[i]].trigger == triggers[i]) {
+            ++end[i];
         }
+    }
 
-        *activated = true;
+    while (true) {
+        uint8_t best = ARRAY_SIZE(triggers);
+        for (uint8_t i = 0; i < ARRAY_SIZE(triggers); ++i) {
+            if (next[i] < end[i] && (best == ARRAY_SIZE(triggers) || key_override_index[next[i]].override_index < key_override_index[next[best]].override_index)) {
+                best = i;
+            }
+        }
+        if (best == ARRAY_SIZE(triggers)) {
+            return false;
+        }
 
-        // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
-        return !trigger_down;
+        const key_override_t *const override = key_override_get(key_override_index[next[best]++].override_index);
+        if (override != NULL && try_activating_single_override(override, keycode, layer, key_down, is_mod, active_mods, send_key_action)) {
+            return true;
+        }
     }
+}
+#endif
+
+/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
+static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
+    bool send_key_action = true;
 
     *activated = false;
 
-    return true;
+    if (key_override_count() == 0) {
+        return true;
+    }
+
+#ifdef KEY_OVERRIDE_INDEX_LENGTH
+    if (!key_override_index_built) {
+        key_override_index_rebuild();
+    }
+
+    if (key_override_index_valid) {
+        *activated = try_activating_indexed_override(keycode, layer, key_down, is_mod, active_mods, &send_key_action);
+        return send_key_action;
+    }
+#endif
+
+    for (uint16_t i = 0; i < key_override_count(); i++) {
+        const key_override_t *const override = key_override_get(i);
+
+        // End of array
+        if (override == NULL) {
+            break;
+        }
+
+        if (try_activating_single_override(override, keycode, layer, key_down, is_mod, active_mods, &send_key_action)) {
+            *activated = true;
+            break;
+        }
+    }
+
+    return send_key_action;
 }
 
 void key_override_task(void) {
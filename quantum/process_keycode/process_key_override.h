@@ -105,6 +105,11 @@ bool process_key_override(const uint16_t keycode, const keyrecord_t *const recor
 /** Perform any deferred keys */
 void key_override_task(void);
 
+#ifdef KEY_OVERRIDE_INDEX_LENGTH
+/** Rebuilds the trigger index. Call after changing the overrides returned by key_override_count() and key_override_get() */
+void key_override_index_rebuild(void);
+#endif
+
 /**
  *  Preferrably use these macros to create key overrides. They fix many of the options to a standard setting that should satisfy most basic use-cases. Only directly create a key_override_t struct when you really need to.
  */
@@ -24,7 +24,11 @@
 #include "keymap_introspection.h"
 
 static uint16_t active_td;
+#ifdef KEYEVENT_TIME_US
+static uint32_t last_tap_time;
+#else
 static uint16_t last_tap_time;
+#endif
 
 void tap_dance_pair_on_each_tap(tap_dance_state_t *state, void *user_data) {
     tap_dance_pair_t *pair = (tap_dance_pair_t *)user_data;
@@ -164,7 +168,11 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 
             action->state.pressed = record->event.pressed;
             if (record->event.pressed) {
+#ifdef KEYEVENT_TIME_US
+                last_tap_time = record->event.time_us;
+#else
                 last_tap_time = timer_read();
+#endif
                 process_tap_dance_action_on_each_tap(action);
                 active_td = action->state.finished ? 0 : keycode;
             } else {
@@ -186,7 +194,11 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 void tap_dance_task(void) {
     tap_dance_action_t *action;
 
+#ifdef KEYEVENT_TIME_US
+    if (!active_td || timer_elapsed_us(last_tap_time) <= (uint32_t)GET_TAPPING_TERM(active_td, &(keyrecord_t){}) * 1000) return;
+#else
     if (!active_td || timer_elapsed(last_tap_time) <= GET_TAPPING_TERM(active_td, &(keyrecord_t){})) return;
+#endif
 
     action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
     if (!action->state.interrupted) {
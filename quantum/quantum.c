@@ -84,6 +84,10 @@
 #    include "process_layer_lock.h"
 #endif
 
+#ifdef EEPROM_DRIVER
+#    include "eeprom_driver.h"
+#endif
+
 #ifdef AUDIO_ENABLE
 #    ifndef GOODBYE_SONG
 #        define GOODBYE_SONG SONG(GOODBYE_SOUND)
@@ -210,6 +214,12 @@ void shutdown_quantum(bool jump_to_bootloader) {
 #ifdef HAPTIC_ENABLE
     haptic_shutdown();
 #endif
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_CACHE)
+    dynamic_keymap_flush();
+#endif
+#ifdef EEPROM_DRIVER
+    eeprom_driver_flush();
+#endif
 }
 
 void reset_keyboard(void) {
@@ -271,6 +281,59 @@ void post_process_record_quantum(keyrecord_t *record) {
     post_process_record_kb(keycode, record);
 }
 
+/* Keycode ranges of the handlers that ignore every keycode outside of
+   their own range. The keycode is classified once per event, and those
+   handlers are only called for keycodes in their range.              */
+typedef enum {
+    KEYCODE_RANGE_OTHER,
+    KEYCODE_RANGE_PERSISTENT_DEF_LAYER,
+    KEYCODE_RANGE_TAP_DANCE,
+    KEYCODE_RANGE_MAGIC,
+    KEYCODE_RANGE_MIDI,
+    KEYCODE_RANGE_SEQUENCER,
+    KEYCODE_RANGE_JOYSTICK,
+    KEYCODE_RANGE_PROGRAMMABLE_BUTTON,
+    KEYCODE_RANGE_AUDIO,
+    KEYCODE_RANGE_STENO,
+    KEYCODE_RANGE_CONNECTION,
+    KEYCODE_RANGE_LIGHTING,
+    KEYCODE_RANGE_QUANTUM,
+    KEYCODE_RANGE_UNICODE,
+} keycode_range_t;
+
+static inline keycode_range_t get_keycode_range(uint16_t keycode) {
+    switch (keycode) {
+        case QK_PERSISTENT_DEF_LAYER ... QK_PERSISTENT_DEF_LAYER_MAX:
+            return KEYCODE_RANGE_PERSISTENT_DEF_LAYER;
+        case QK_TAP_DANCE ... QK_TAP_DANCE_MAX:
+            return KEYCODE_RANGE_TAP_DANCE;
+        case QK_MAGIC ... QK_MAGIC_MAX:
+            return KEYCODE_RANGE_MAGIC;
+        case QK_MIDI ... QK_MIDI_MAX:
+            return KEYCODE_RANGE_MIDI;
+        case QK_SEQUENCER ... QK_SEQUENCER_MAX:
+            return KEYCODE_RANGE_SEQUENCER;
+        case QK_JOYSTICK ... QK_JOYSTICK_MAX:
+            return KEYCODE_RANGE_JOYSTICK;
+        case QK_PROGRAMMABLE_BUTTON ... QK_PROGRAMMABLE_BUTTON_MAX:
+            return KEYCODE_RANGE_PROGRAMMABLE_BUTTON;
+        case QK_AUDIO ... QK_AUDIO_MAX:
+            return KEYCODE_RANGE_AUDIO;
+        case QK_STENO ... QK_STENO_MAX:
+            return KEYCODE_RANGE_STENO;
+        case QK_CONNECTION ... QK_CONNECTION_MAX:
+            return KEYCODE_RANGE_CONNECTION;
+        case QK_LIGHTING ... QK_LIGHTING_MAX:
+            return KEYCODE_RANGE_LIGHTING;
+        case QK_QUANTUM ... QK_QUANTUM_MAX:
+            return KEYCODE_RANGE_QUANTUM;
+        case QK_UNICODE ... QK_UNICODE_MAX:
+            return KEYCODE_RANGE_UNICODE;
+        default:
+            return KEYCODE_RANGE_OTHER;
+    }
+}
+
 /* Core keycode function, hands off handling to other functions,
     then processes internal quantum keycodes, and then processes
     ACTIONs.                                                      */
@@ -311,6 +374,9 @@ bool process_record_quantum(keyrecord_t *record) {
     }
 #endif
 
+    // process_key_lock() only replaces one-shot mods with basic keycodes, which are both KEYCODE_RANGE_OTHER
+    const keycode_range_t range = get_keycode_range(keycode);
+
     if (!(
 #if defined(KEY_LOCK_ENABLE)
             // Must run first to be able to mask key_up events.
@@ -340,22 +406,22 @@ bool process_record_quantum(keyrecord_t *record) {
             process_secure(keycode, record) &&
 #endif
 #if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
+            (range != KEYCODE_RANGE_SEQUENCER || process_sequencer(keycode, record)) &&
 #endif
 #if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
-            process_midi(keycode, record) &&
+            (range != KEYCODE_RANGE_MIDI || process_midi(keycode, record)) &&
 #endif
 #ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
+            (range != KEYCODE_RANGE_AUDIO || process_audio(keycode, record)) &&
 #endif
 #if defined(BACKLIGHT_ENABLE)
-            process_backlight(keycode, record) &&
+            (range != KEYCODE_RANGE_LIGHTING || process_backlight(keycode, record)) &&
 #endif
 #if defined(LED_MATRIX_ENABLE)
-            process_led_matrix(keycode, record) &&
+            (range != KEYCODE_RANGE_LIGHTING || process_led_matrix(keycode, record)) &&
 #endif
 #ifdef STENO_ENABLE
-            process_steno(keycode, record) &&
+            (range != KEYCODE_RANGE_STENO || process_steno(keycode, record)) &&
 #endif
 #if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
             process_music(keycode, record) &&
@@ -367,10 +433,15 @@ bool process_record_quantum(keyrecord_t *record) {
             process_key_override(keycode, record) &&
 #endif
 #ifdef TAP_DANCE_ENABLE
-            process_tap_dance(keycode, record) &&
+            (range != KEYCODE_RANGE_TAP_DANCE || process_tap_dance(keycode, record)) &&
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
+#    ifdef UCIS_ENABLE
+            // an active UCIS input consumes every key
             process_unicode_common(keycode, record) &&
+#    else
+            ((range != KEYCODE_RANGE_QUANTUM && range != KEYCODE_RANGE_UNICODE) || process_unicode_common(keycode, record)) &&
+#    endif
 #endif
 #ifdef LEADER_ENABLE
             process_leader(keycode, record) &&
@@ -379,43 +450,43 @@ bool process_record_quantum(keyrecord_t *record) {
             process_auto_shift(keycode, record) &&
 #endif
 #ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
+            (range != KEYCODE_RANGE_QUANTUM || process_dynamic_tapping_term(keycode, record)) &&
 #endif
 #ifdef SPACE_CADET_ENABLE
             process_space_cadet(keycode, record) &&
 #endif
 #ifdef MAGIC_ENABLE
-            process_magic(keycode, record) &&
+            (range != KEYCODE_RANGE_MAGIC || process_magic(keycode, record)) &&
 #endif
 #ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
+            (range != KEYCODE_RANGE_QUANTUM || process_grave_esc(keycode, record)) &&
 #endif
 #if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_underglow(keycode, record) &&
+            (range != KEYCODE_RANGE_LIGHTING || process_underglow(keycode, record)) &&
 #endif
 #if defined(RGB_MATRIX_ENABLE)
-            process_rgb_matrix(keycode, record) &&
+            (range != KEYCODE_RANGE_LIGHTING || process_rgb_matrix(keycode, record)) &&
 #endif
 #ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
+            (range != KEYCODE_RANGE_JOYSTICK || process_joystick(keycode, record)) &&
 #endif
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
+            (range != KEYCODE_RANGE_PROGRAMMABLE_BUTTON || process_programmable_button(keycode, record)) &&
 #endif
 #ifdef AUTOCORRECT_ENABLE
             process_autocorrect(keycode, record) &&
 #endif
 #ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
+            (range != KEYCODE_RANGE_QUANTUM || process_tri_layer(keycode, record)) &&
 #endif
 #if !defined(NO_ACTION_LAYER)
-            process_default_layer(keycode, record) &&
+            (range != KEYCODE_RANGE_PERSISTENT_DEF_LAYER || process_default_layer(keycode, record)) &&
 #endif
 #ifdef LAYER_LOCK_ENABLE
             process_layer_lock(keycode, record) &&
 #endif
 #ifdef BLUETOOTH_ENABLE
-            process_connection(keycode, record) &&
+            (range != KEYCODE_RANGE_CONNECTION || process_connection(keycode, record)) &&
 #endif
             true)) {
         return false;
@@ -527,6 +598,12 @@ __attribute__((weak)) bool shutdown_kb(bool jump_to_bootloader) {
 
 void suspend_power_down_quantum(void) {
     suspend_power_down_kb();
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_CACHE)
+    dynamic_keymap_flush();
+#endif
+#ifdef EEPROM_DRIVER
+    eeprom_driver_flush();
+#endif
 #ifndef NO_SUSPEND_POWER_DOWN
 // Turn off backlight
 #    ifdef BACKLIGHT_ENABLE
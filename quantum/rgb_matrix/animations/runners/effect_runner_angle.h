@@ -0,0 +1,16 @@
+#pragma once
+
+typedef hsv_t (*angle_f)(hsv_t hsv, uint8_t angle, uint8_t time);
+
+bool effect_runner_angle(effect_params_t* params, angle_f effect_func) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+
+    uint8_t time = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 2);
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+        uint8_t angle = rgb_matrix_led_center_angle(i);
+        rgb_t   rgb   = rgb_matrix_hsv_to_rgb(effect_func(rgb_matrix_config.hsv, angle, time));
+        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+    }
+    return rgb_matrix_check_finished_leds(led_max);
+}
@@ -32,9 +32,7 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
             if (i_row == row && i_col == col) {
                 g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
             } else {
-#            define LED_DISTANCE(led_a, led_b) sqrt16(((int16_t)(led_a.x - led_b.x) * (int16_t)(led_a.x - led_b.x)) + ((int16_t)(led_a.y - led_b.y) * (int16_t)(led_a.y - led_b.y)))
-                uint8_t distance = LED_DISTANCE(g_led_config.point[g_led_config.matrix_co[row][col]], g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
-#            undef LED_DISTANCE
+                uint8_t distance = rgb_matrix_led_distance(g_led_config.matrix_co[row][col], g_led_config.matrix_co[i_row][i_col]);
                 if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
                     uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
                     if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
@@ -39,6 +39,71 @@ __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+// Distance and angle of each LED from k_rgb_matrix_center
+static uint8_t led_center_dist[RGB_MATRIX_LED_COUNT];
+static uint8_t led_center_angle[RGB_MATRIX_LED_COUNT];
+#endif // RGB_MATRIX_GEOMETRY_CACHE
+#ifdef RGB_MATRIX_LED_DISTANCE_CACHE
+// Distance between each pair of LEDs, stored as the lower triangle of the matrix
+static uint8_t led_pair_dist[RGB_MATRIX_LED_COUNT * (RGB_MATRIX_LED_COUNT - 1) / 2];
+#endif // RGB_MATRIX_LED_DISTANCE_CACHE
+
+static inline uint8_t led_dist(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
+    int16_t dx = x0 - x1;
+    int16_t dy = y0 - y1;
+    return sqrt16(dx * dx + dy * dy);
+}
+
+static inline uint8_t rgb_matrix_led_center_dist(uint8_t i) {
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+    return led_center_dist[i];
+#else
+    return led_dist(g_led_config.point[i].x, g_led_config.point[i].y, k_rgb_matrix_center.x, k_rgb_matrix_center.y);
+#endif
+}
+
+static inline uint8_t rgb_matrix_led_center_angle(uint8_t i) {
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+    return led_center_angle[i];
+#else
+    return atan2_8(g_led_config.point[i].y - k_rgb_matrix_center.y, g_led_config.point[i].x - k_rgb_matrix_center.x);
+#endif
+}
+
+static inline uint8_t rgb_matrix_led_distance(uint8_t a, uint8_t b) {
+#ifdef RGB_MATRIX_LED_DISTANCE_CACHE
+    if (a == b) {
+        return 0;
+    }
+    if (a < b) {
+        uint8_t t = a;
+        a         = b;
+        b         = t;
+    }
+    return led_pair_dist[(uint16_t)a * (a - 1) / 2 + b];
+#else
+    return led_dist(g_led_config.point[a].x, g_led_config.point[a].y, g_led_config.point[b].x, g_led_config.point[b].y);
+#endif
+}
+
+void rgb_matrix_update_geometry_cache(void) {
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        led_center_dist[i]  = led_dist(g_led_config.point[i].x, g_led_config.point[i].y, k_rgb_matrix_center.x, k_rgb_matrix_center.y);
+        led_center_angle[i] = atan2_8(g_led_config.point[i].y - k_rgb_matrix_center.y, g_led_config.point[i].x - k_rgb_matrix_center.x);
+    }
+#endif // RGB_MATRIX_GEOMETRY_CACHE
+#ifdef RGB_MATRIX_LED_DISTANCE_CACHE
+    uint16_t n = 0;
+    for (uint8_t a = 1; a < RGB_MATRIX_LED_COUNT; a++) {
+        for (uint8_t b = 0; b < a; b++) {
+            led_pair_dist[n++] = led_dist(g_led_config.point[a].x, g_led_config.point[a].y, g_led_config.point[b].x, g_led_config.point[b].y);
+        }
+    }
+#endif // RGB_MATRIX_LED_DISTANCE_CACHE
+}
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -83,6 +148,30 @@ static uint32_t rgb_timer_buffer;
 static last_hit_t last_hit_buffer;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+// dirty tracking
+typedef enum rgb_writer_t {
+    RGB_WRITER_EXTERNAL,
+    RGB_WRITER_EFFECT,
+    RGB_WRITER_INDICATORS,
+} rgb_writer_t;
+
+#    define RGB_LED_BITMAP_SIZE ((RGB_MATRIX_LED_COUNT + 7) / 8)
+
+static rgb_t        rgb_shadow[RGB_MATRIX_LED_COUNT];
+static bool         rgb_dirty          = false;
+static bool         rgb_external_write = false;
+static bool         rgb_effect_idle    = false;
+static rgb_config_t rgb_idle_config    = {0};
+static rgb_writer_t rgb_writer         = RGB_WRITER_EXTERNAL;
+static uint8_t      rgb_indicator_leds[RGB_LED_BITMAP_SIZE];
+static uint8_t      rgb_last_indicator_leds[RGB_LED_BITMAP_SIZE];
+
+#    define RGB_MATRIX_SET_WRITER(writer) rgb_writer = (writer)
+#else
+#    define RGB_MATRIX_SET_WRITER(writer)
+#endif // RGB_MATRIX_DIRTY_TRACKING
+
 // split rgb matrix
 #if defined(RGB_MATRIX_SPLIT)
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
@@ -153,11 +242,36 @@ __attribute__((weak)) int rgb_matrix_led_index(int index) {
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+    if (index < 0 || index >= RGB_MATRIX_LED_COUNT) {
+        return;
+    }
+
+    if (rgb_writer == RGB_WRITER_INDICATORS) {
+        rgb_indicator_leds[index / 8] |= 1 << (index % 8);
+    }
+
+    // Skip the driver entirely if the LED already has this colour
+    rgb_t *shadow = &rgb_shadow[index];
+    if (shadow->r == red && shadow->g == green && shadow->b == blue) {
+        return;
+    }
+    shadow->r = red;
+    shadow->g = green;
+    shadow->b = blue;
+    rgb_dirty = true;
+
+    // Changes made outside of rendering must be overwritten by the effect, as they would be without tracking
+    if (rgb_writer == RGB_WRITER_EXTERNAL) {
+        rgb_external_write = true;
+        rgb_effect_idle    = false;
+    }
+#endif // RGB_MATRIX_DIRTY_TRACKING
     rgb_matrix_driver.set_color(rgb_matrix_led_index(index), red, green, blue);
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
-#if defined(RGB_MATRIX_SPLIT)
+#if defined(RGB_MATRIX_SPLIT) || defined(RGB_MATRIX_DIRTY_TRACKING)
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
@@ -239,6 +353,27 @@ void rgb_matrix_test(void) {
     }
 }
 
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+// Effects whose output depends only on rgb_matrix_config, which can stop rendering until it changes
+static bool rgb_matrix_effect_is_static(uint8_t effect) {
+    switch (effect) {
+        case RGB_MATRIX_SOLID_COLOR:
+#    ifdef ENABLE_RGB_MATRIX_ALPHAS_MODS
+        case RGB_MATRIX_ALPHAS_MODS:
+#    endif
+#    ifdef ENABLE_RGB_MATRIX_GRADIENT_UP_DOWN
+        case RGB_MATRIX_GRADIENT_UP_DOWN:
+#    endif
+#    ifdef ENABLE_RGB_MATRIX_GRADIENT_LEFT_RIGHT
+        case RGB_MATRIX_GRADIENT_LEFT_RIGHT:
+#    endif
+            return true;
+        default:
+            return false;
+    }
+}
+#endif // RGB_MATRIX_DIRTY_TRACKING
+
 static bool rgb_matrix_none(effect_params_t *params) {
     if (!params->init) {
         return false;
@@ -283,6 +418,12 @@ static void rgb_task_start(void) {
     g_last_hit_tracker = last_hit_buffer;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+    if (rgb_idle_config.raw != rgb_matrix_config.raw) {
+        rgb_effect_idle = false;
+    }
+#endif // RGB_MATRIX_DIRTY_TRACKING
+
     // next task
     rgb_task_state = RENDERING;
 }
@@ -295,6 +436,20 @@ static void rgb_task_render(uint8_t effect) {
         rgb_matrix_set_color_all(0, 0, 0);
     }
 
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+    if (rgb_effect_idle && !rgb_effect_params.init) {
+        // Nothing has changed since the static effect was last rendered, so only step through the iterations for the indicators
+        RGB_MATRIX_USE_LIMITS_ITER(led_min, led_max, rgb_effect_params.iter);
+        rgb_effect_params.iter++;
+        if (!rgb_matrix_check_finished_leds(led_max)) {
+            rgb_task_state = FLUSHING;
+        }
+        return;
+    }
+#endif // RGB_MATRIX_DIRTY_TRACKING
+
+    RGB_MATRIX_SET_WRITER(RGB_WRITER_EFFECT);
+
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
     switch (effect) {
@@ -331,10 +486,12 @@ static void rgb_task_render(uint8_t effect) {
         case UINT8_MAX: {
             rgb_matrix_test();
             rgb_task_state = FLUSHING;
+            RGB_MATRIX_SET_WRITER(RGB_WRITER_EXTERNAL);
         }
             return;
     }
 
+    RGB_MATRIX_SET_WRITER(RGB_WRITER_EXTERNAL);
     rgb_effect_params.iter++;
 
     // next task
@@ -352,8 +509,27 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_last_effect = effect;
     rgb_last_enable = rgb_matrix_config.enable;
 
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+    // A static effect can go idle once rendered, unless the indicators stopped lighting an LED, which the effect has to restore
+    bool indicators_dropped = false;
+    for (uint8_t i = 0; i < RGB_LED_BITMAP_SIZE; i++) {
+        indicators_dropped |= (rgb_last_indicator_leds[i] & ~rgb_indicator_leds[i]) != 0;
+    }
+    memcpy(rgb_last_indicator_leds, rgb_indicator_leds, RGB_LED_BITMAP_SIZE);
+    memset(rgb_indicator_leds, 0, RGB_LED_BITMAP_SIZE);
+    rgb_effect_idle    = rgb_matrix_effect_is_static(effect) && !indicators_dropped && !rgb_external_write;
+    rgb_idle_config    = rgb_matrix_config;
+    rgb_external_write = false;
+
+    // update pwm buffers, only if an LED has changed since the last flush
+    if (rgb_dirty) {
+        rgb_dirty = false;
+        rgb_matrix_update_pwm_buffers();
+    }
+#else
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
+#endif // RGB_MATRIX_DIRTY_TRACKING
 
     // next task
     rgb_task_state = SYNCING;
@@ -379,10 +555,12 @@ void rgb_matrix_task(void) {
         case RENDERING:
             rgb_task_render(effect);
             if (effect) {
+                RGB_MATRIX_SET_WRITER(RGB_WRITER_INDICATORS);
                 if (rgb_task_state == FLUSHING) { // ensure we only draw basic indicators once rendering is finished
                     rgb_matrix_indicators();
                 }
                 rgb_matrix_indicators_advanced(&rgb_effect_params);
+                RGB_MATRIX_SET_WRITER(RGB_WRITER_EXTERNAL);
             }
             break;
         case FLUSHING:
@@ -455,6 +633,8 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
+    rgb_matrix_update_geometry_cache();
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
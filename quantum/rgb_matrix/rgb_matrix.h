@@ -168,6 +168,8 @@ void rgb_matrix_init(void);
 
 void rgb_matrix_reload_from_eeprom(void);
 
+void rgb_matrix_update_geometry_cache(void);
+
 void        rgb_matrix_set_suspend_state(bool state);
 bool        rgb_matrix_get_suspend_state(void);
 void        rgb_matrix_toggle(void);
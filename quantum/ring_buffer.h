@@ -1,48 +1,151 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
 #pragma once
 
+/**
+ * Lock-free single-producer/single-consumer ring buffer.
+ *
+ * `RING_BUFFER_DEFINE(name, type, size)` declares the type `name_t` holding up to `size` elements of
+ * `type`, along with the `name_*()` functions operating on it. The size may be anything from 1 to
+ * 255; one extra slot is allocated so that a full ring can be told apart from an empty one.
+ *
+ * One side may only push and the other may only pop, peek or skip; with that split, an interrupt
+ * handler can be either side without disabling interrupts. The head is only written by the producer
+ * and the tail only by the consumer, and both are single bytes so that they are read and written
+ * atomically on every supported MCU.
+ *
+ * Example:
+ *     RING_BUFFER_DEFINE(event_queue, event_t, 16)
+ *     static event_queue_t events;
+ *
+ *     event_queue_push(&events, event);     // producer
+ *     while (event_queue_pop(&events, &e))  // consumer
+ */
+
 #include <stdint.h>
 #include <stdbool.h>
-#include "atomic_util.h"
 
-#ifndef RBUF_SIZE
-#    define RBUF_SIZE 32
+#ifdef __cplusplus
+#    define RING_BUFFER_STATIC_ASSERT static_assert
+#else
+#    define RING_BUFFER_STATIC_ASSERT _Static_assert
 #endif
 
-static uint8_t     rbuf[RBUF_SIZE];
-static uint8_t     rbuf_head = 0;
-static uint8_t     rbuf_tail = 0;
-static inline bool rbuf_enqueue(uint8_t data) {
-    bool ret = false;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        uint8_t next = (rbuf_head + 1) % RBUF_SIZE;
-        if (next != rbuf_tail) {
-            rbuf[rbuf_head] = data;
-            rbuf_head       = next;
-            ret             = true;
-        }
-    }
-    return ret;
+typedef struct ring_buffer_indices_t {
+    uint8_t head; // next slot to write, only written by the producer
+    uint8_t tail; // next slot to read, only written by the consumer
+} ring_buffer_indices_t;
+
+// Moves an index forward by count slots, in a ring of size + 1 slots
+static inline uint8_t ring_buffer_advance(uint8_t index, uint8_t count, uint8_t size) {
+    uint16_t next = (uint16_t)index + count;
+    return next > size ? (uint8_t)(next - size - 1) : (uint8_t)next;
 }
-static inline uint8_t rbuf_dequeue(void) {
-    uint8_t val = 0;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        if (rbuf_head != rbuf_tail) {
-            val       = rbuf[rbuf_tail];
-            rbuf_tail = (rbuf_tail + 1) % RBUF_SIZE;
-        }
-    }
 
-    return val;
+// Number of slots from tail up to head, in a ring of size + 1 slots
+static inline uint8_t ring_buffer_used(uint8_t head, uint8_t tail, uint8_t size) {
+    return head >= tail ? head - tail : (uint8_t)(size + 1 - (tail - head));
 }
-static inline bool rbuf_has_data(void) {
-    bool has_data;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        has_data = (rbuf_head != rbuf_tail);
-    }
-    return has_data;
+
+// Number of free slots, as seen by the producer
+static inline uint8_t ring_buffer_space(const ring_buffer_indices_t *indices, uint8_t size) {
+    uint8_t tail = __atomic_load_n(&indices->tail, __ATOMIC_ACQUIRE);
+    return size - ring_buffer_used(indices->head, tail, size);
 }
-static inline void rbuf_clear(void) {
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        rbuf_head = rbuf_tail = 0;
-    }
+
+// Number of used slots, as seen by the consumer
+static inline uint8_t ring_buffer_count(const ring_buffer_indices_t *indices, uint8_t size) {
+    uint8_t head = __atomic_load_n(&indices->head, __ATOMIC_ACQUIRE);
+    return ring_buffer_used(head, indices->tail, size);
+}
+
+// Publishes the elements written since the last commit to the consumer
+static inline void ring_buffer_commit_push(ring_buffer_indices_t *indices, uint8_t count, uint8_t size) {
+    __atomic_store_n(&indices->head, ring_buffer_advance(indices->head, count, size), __ATOMIC_RELEASE);
 }
+
+// Hands the slots of the elements read since the last commit back to the producer
+static inline void ring_buffer_commit_pop(ring_buffer_indices_t *indices, uint8_t count, uint8_t size) {
+    __atomic_store_n(&indices->tail, ring_buffer_advance(indices->tail, count, size), __ATOMIC_RELEASE);
+}
+
+// clang-format off
+#define RING_BUFFER_DEFINE(name, type, size)                                                                           \
+    RING_BUFFER_STATIC_ASSERT((size) > 0 && (size) <= 255, "Ring buffer size must be between 1 and 255");              \
+                                                                                                                       \
+    typedef struct name##_t {                                                                                          \
+        ring_buffer_indices_t indices;                                                                                 \
+        type                  data[(size) + 1];                                                                        \
+    } name##_t;                                                                                                        \
+                                                                                                                       \
+    /* Pushes as many of the elements as fit, returning the number pushed */                                           \
+    static inline uint8_t name##_push_many(name##_t *ring, const type *items, uint8_t count) {                         \
+        uint8_t space = ring_buffer_space(&ring->indices, (size));                                                     \
+        if (count > space) {                                                                                           \
+            count = space;                                                                                             \
+        }                                                                                                              \
+        for (uint8_t i = 0; i < count; ++i) {                                                                          \
+            ring->data[ring_buffer_advance(ring->indices.head, i, (size))] = items[i];                                 \
+        }                                                                                                              \
+        ring_buffer_commit_push(&ring->indices, count, (size));                                                        \
+        return count;                                                                                                  \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool name##_push(name##_t *ring, type item) {                                                        \
+        return name##_push_many(ring, &item, 1) == 1;                                                                  \
+    }                                                                                                                  \
+                                                                                                                       \
+    /* Copies up to count of the oldest elements without removing them, returning the number copied */                 \
+    static inline uint8_t name##_peek_many(name##_t *ring, type *items, uint8_t count) {                               \
+        uint8_t available = ring_buffer_count(&ring->indices, (size));                                                 \
+        if (count > available) {                                                                                       \
+            count = available;                                                                                         \
+        }                                                                                                              \
+        for (uint8_t i = 0; i < count; ++i) {                                                                          \
+            items[i] = ring->data[ring_buffer_advance(ring->indices.tail, i, (size))];                                 \
+        }                                                                                                              \
+        return count;                                                                                                  \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool name##_peek(name##_t *ring, type *item) {                                                       \
+        return name##_peek_many(ring, item, 1) == 1;                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    /* Removes up to count of the oldest elements, returning the number removed */                                     \
+    static inline uint8_t name##_skip(name##_t *ring, uint8_t count) {                                                 \
+        uint8_t available = ring_buffer_count(&ring->indices, (size));                                                 \
+        if (count > available) {                                                                                       \
+            count = available;                                                                                         \
+        }                                                                                                              \
+        ring_buffer_commit_pop(&ring->indices, count, (size));                                                         \
+        return count;                                                                                                  \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline uint8_t name##_pop_many(name##_t *ring, type *items, uint8_t count) {                                \
+        count = name##_peek_many(ring, items, count);                                                                  \
+        ring_buffer_commit_pop(&ring->indices, count, (size));                                                         \
+        return count;                                                                                                  \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool name##_pop(name##_t *ring, type *item) {                                                        \
+        return name##_pop_many(ring, item, 1) == 1;                                                                    \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline uint8_t name##_count(name##_t *ring) {                                                               \
+        return ring_buffer_count(&ring->indices, (size));                                                              \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline uint8_t name##_space(name##_t *ring) {                                                               \
+        return ring_buffer_space(&ring->indices, (size));                                                              \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool name##_is_empty(name##_t *ring) {                                                               \
+        return name##_count(ring) == 0;                                                                                \
+    }                                                                                                                  \
+                                                                                                                       \
+    /* Discards everything pushed so far; only to be called by the consumer */                                         \
+    static inline void name##_clear(name##_t *ring) {                                                                  \
+        uint8_t count = ring_buffer_count(&ring->indices, (size));                                                     \
+        ring_buffer_commit_pop(&ring->indices, count, (size));                                                         \
+    }
+// clang-format on
@@ -19,11 +19,125 @@
 #include <ctype.h>
 #include <stdlib.h>
 
-#include "quantum_keycodes.h"
-#include "keycode.h"
-#include "action.h"
+#include "quantum.h"
 #include "wait.h"
 
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include "timer.h"
+
+#    ifndef SEND_STRING_ASYNC_QUEUE_SIZE
+#        define SEND_STRING_ASYNC_QUEUE_SIZE 64
+#    endif
+
+// Minimum time between two reports sent from the queue, so that the host sees each of them
+#    ifndef SEND_STRING_ASYNC_REPORT_INTERVAL
+#        ifdef USB_POLLING_INTERVAL_MS
+#            define SEND_STRING_ASYNC_REPORT_INTERVAL USB_POLLING_INTERVAL_MS
+#        else
+#            define SEND_STRING_ASYNC_REPORT_INTERVAL 1
+#        endif
+#    endif
+
+// Most entries taken by one character: Shift, AltGr, the key, and a space for dead keys, each pressed and released
+#    define SEND_STRING_ASYNC_CHAR_ENTRIES 8
+#    define SEND_STRING_ASYNC_CALLBACK_ENTRIES 2
+
+_Static_assert(SEND_STRING_ASYNC_QUEUE_SIZE > SEND_STRING_ASYNC_CHAR_ENTRIES + SEND_STRING_ASYNC_CALLBACK_ENTRIES, "SEND_STRING_ASYNC_QUEUE_SIZE is too small");
+
+enum send_string_async_action {
+    SEND_STRING_ASYNC_REGISTER,
+    SEND_STRING_ASYNC_UNREGISTER,
+    SEND_STRING_ASYNC_DELAY,
+    SEND_STRING_ASYNC_SET_MODS,
+    SEND_STRING_ASYNC_CLEAR_WEAK_MODS,
+    SEND_STRING_ASYNC_CALLBACK, // Always followed by a SEND_STRING_ASYNC_CONTEXT entry
+    SEND_STRING_ASYNC_CONTEXT,
+};
+
+typedef struct {
+    uint8_t action;
+    union {
+        struct {
+            uint16_t keycode;  // Modifiers for SEND_STRING_ASYNC_SET_MODS
+            uint16_t delay_ms; // Time to wait before sending the next entry
+        };
+        send_string_async_callback_t callback;
+        void                        *context;
+    };
+} send_string_async_entry_t;
+
+static send_string_async_entry_t queue[SEND_STRING_ASYNC_QUEUE_SIZE];
+
+static uint16_t queue_head     = 0; // Next entry to send
+static uint16_t queue_tail     = 0; // End of the entries handed over to send_string_task()
+static uint16_t queue_write    = 0; // End of the entries still being queued
+static uint8_t  capture_depth  = 0;
+static bool     queue_overflow = false;
+static uint16_t last_send_time = 0;
+static uint16_t next_delay_ms  = 0;
+
+// String being decoded into the queue as room becomes available
+static bool                         stream_active = false;
+static const char                  *stream_string;
+static uint8_t                      stream_interval;
+static send_string_async_reader_t   stream_reader;
+static send_string_async_callback_t stream_callback;
+static void                        *stream_context;
+
+static inline uint16_t queue_next(uint16_t index) {
+    return (index + 1 == SEND_STRING_ASYNC_QUEUE_SIZE) ? 0 : index + 1;
+}
+
+static send_string_async_entry_t *queue_push(uint8_t action) {
+    uint16_t next = queue_next(queue_write);
+    if (next == queue_head) {
+        queue_overflow = true;
+        return NULL;
+    }
+
+    send_string_async_entry_t *entry = &queue[queue_write];
+    entry->action                    = action;
+    entry->keycode                   = 0;
+    entry->delay_ms                  = 0;
+    queue_write                      = next;
+    return entry;
+}
+
+static void queue_key(uint8_t action, uint16_t keycode) {
+    send_string_async_entry_t *entry = queue_push(action);
+    if (entry) {
+        entry->keycode = keycode;
+    }
+}
+
+static void queue_wait(uint16_t ms) {
+    // Fold the wait into the previous key or delay, unless that has already been handed over
+    if (queue_write != queue_tail) {
+        send_string_async_entry_t *last = &queue[(queue_write == 0 ? SEND_STRING_ASYNC_QUEUE_SIZE : queue_write) - 1];
+        if (last->action <= SEND_STRING_ASYNC_DELAY) {
+            last->delay_ms = (ms > UINT16_MAX - last->delay_ms) ? UINT16_MAX : last->delay_ms + ms;
+            return;
+        }
+    }
+
+    send_string_async_entry_t *entry = queue_push(SEND_STRING_ASYNC_DELAY);
+    if (entry) {
+        entry->delay_ms = ms;
+    }
+}
+
+static void queue_callback(send_string_async_callback_t callback, void *context) {
+    send_string_async_entry_t *entry = queue_push(SEND_STRING_ASYNC_CALLBACK);
+    if (entry) {
+        entry->callback = callback;
+        entry           = queue_push(SEND_STRING_ASYNC_CONTEXT);
+        if (entry) {
+            entry->context = context;
+        }
+    }
+}
+#endif
+
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
 #    ifndef BELL_SOUND
@@ -146,6 +260,70 @@ __attribute__((weak)) const uint8_t ascii_to_keycode_lut[128] PROGMEM = {
 // Note: we bit-pack in "reverse" order to optimize loading
 #define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
 
+void send_string_register_code(uint16_t keycode) {
+#ifdef SEND_STRING_ASYNC_ENABLE
+    if (capture_depth) {
+        queue_key(SEND_STRING_ASYNC_REGISTER, keycode);
+        return;
+    }
+#endif
+    register_code16(keycode);
+}
+
+void send_string_unregister_code(uint16_t keycode) {
+#ifdef SEND_STRING_ASYNC_ENABLE
+    if (capture_depth) {
+        queue_key(SEND_STRING_ASYNC_UNREGISTER, keycode);
+        return;
+    }
+#endif
+    unregister_code16(keycode);
+}
+
+void send_string_tap_code(uint16_t keycode) {
+#ifdef SEND_STRING_ASYNC_ENABLE
+    if (capture_depth) {
+        queue_key(SEND_STRING_ASYNC_REGISTER, keycode);
+        queue_wait(keycode == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY);
+        queue_key(SEND_STRING_ASYNC_UNREGISTER, keycode);
+        return;
+    }
+#endif
+    tap_code16(keycode);
+}
+
+void send_string_wait(uint16_t ms) {
+#ifdef SEND_STRING_ASYNC_ENABLE
+    if (capture_depth) {
+        if (ms) {
+            queue_wait(ms);
+        }
+        return;
+    }
+#endif
+    wait_ms(ms);
+}
+
+void send_string_set_mods(uint8_t mods) {
+#ifdef SEND_STRING_ASYNC_ENABLE
+    if (capture_depth) {
+        queue_key(SEND_STRING_ASYNC_SET_MODS, mods);
+        return;
+    }
+#endif
+    set_mods(mods);
+}
+
+void send_string_clear_weak_mods(void) {
+#ifdef SEND_STRING_ASYNC_ENABLE
+    if (capture_depth) {
+        queue_push(SEND_STRING_ASYNC_CLEAR_WEAK_MODS);
+        return;
+    }
+#endif
+    clear_weak_mods();
+}
+
 void send_string(const char *string) {
     send_string_with_delay(string, TAP_CODE_DELAY);
 }
@@ -160,15 +338,15 @@ void send_string_with_delay(const char *string, uint8_t interval) {
             if (ascii_code == SS_TAP_CODE) {
                 // tap
                 uint8_t keycode = *(++string);
-                tap_code(keycode);
+                send_string_tap_code(keycode);
             } else if (ascii_code == SS_DOWN_CODE) {
                 // down
                 uint8_t keycode = *(++string);
-                register_code(keycode);
+                send_string_register_code(keycode);
             } else if (ascii_code == SS_UP_CODE) {
                 // up
                 uint8_t keycode = *(++string);
-                unregister_code(keycode);
+                send_string_unregister_code(keycode);
             } else if (ascii_code == SS_DELAY_CODE) {
                 // delay
                 int     ms      = 0;
@@ -180,10 +358,10 @@ void send_string_with_delay(const char *string, uint8_t interval) {
                     keycode = *(++string);
                 }
 
-                wait_ms(ms);
+                send_string_wait(ms);
             }
 
-            wait_ms(interval);
+            send_string_wait(interval);
         } else {
             send_char_with_delay(ascii_code, interval);
         }
@@ -210,31 +388,33 @@ void send_char_with_delay(char ascii_code, uint8_t interval) {
     bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
 
     if (is_shifted) {
-        register_code(KC_LEFT_SHIFT);
-        wait_ms(interval);
+        send_string_register_code(KC_LEFT_SHIFT);
+        send_string_wait(interval);
     }
 
     if (is_altgred) {
-        register_code(KC_RIGHT_ALT);
-        wait_ms(interval);
+        send_string_register_code(KC_RIGHT_ALT);
+        send_string_wait(interval);
     }
 
-    tap_code_delay(keycode, interval);
-    wait_ms(interval);
+    send_string_register_code(keycode);
+    send_string_wait(interval);
+    send_string_unregister_code(keycode);
+    send_string_wait(interval);
 
     if (is_altgred) {
-        unregister_code(KC_RIGHT_ALT);
-        wait_ms(interval);
+        send_string_unregister_code(KC_RIGHT_ALT);
+        send_string_wait(interval);
     }
 
     if (is_shifted) {
-        unregister_code(KC_LEFT_SHIFT);
-        wait_ms(interval);
+        send_string_unregister_code(KC_LEFT_SHIFT);
+        send_string_wait(interval);
     }
 
     if (is_dead) {
-        tap_code(KC_SPACE);
-        wait_ms(interval);
+        send_string_tap_code(KC_SPACE);
+        send_string_wait(interval);
     }
 }
 
@@ -307,15 +487,15 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
             if (ascii_code == SS_TAP_CODE) {
                 // tap
                 uint8_t keycode = pgm_read_byte(++string);
-                tap_code(keycode);
+                send_string_tap_code(keycode);
             } else if (ascii_code == SS_DOWN_CODE) {
                 // down
                 uint8_t keycode = pgm_read_byte(++string);
-                register_code(keycode);
+                send_string_register_code(keycode);
             } else if (ascii_code == SS_UP_CODE) {
                 // up
                 uint8_t keycode = pgm_read_byte(++string);
-                unregister_code(keycode);
+                send_string_unregister_code(keycode);
             } else if (ascii_code == SS_DELAY_CODE) {
                 // delay
                 int     ms      = 0;
@@ -326,7 +506,7 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
                     ms += keycode - '0';
                     keycode = pgm_read_byte(++string);
                 }
-                wait_ms(ms);
+                send_string_wait(ms);
             }
         } else {
             send_char_with_delay(ascii_code, interval);
@@ -336,3 +516,195 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
     }
 }
 #endif
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+static char send_string_async_read(const char *ptr) {
+    return *ptr;
+}
+
+#    if defined(__AVR__)
+static char send_string_async_read_P(const char *ptr) {
+    return pgm_read_byte(ptr);
+}
+#    endif
+
+/* Queues one character or SS_ sequence, returning the position of the next one.
+ * A sequence cut short by the end of the string is dropped.
+ */
+static const char *send_string_async_decode(const char *string, uint8_t interval, send_string_async_reader_t reader) {
+    char ascii_code = reader(string++);
+    if (ascii_code != SS_QMK_PREFIX) {
+        send_char_with_delay(ascii_code, interval);
+        return string;
+    }
+
+    char code = reader(string);
+    if (!code) {
+        return string;
+    }
+    ++string;
+
+    if (code == SS_TAP_CODE || code == SS_DOWN_CODE || code == SS_UP_CODE) {
+        uint8_t keycode = reader(string);
+        if (!keycode) {
+            return string;
+        }
+        ++string;
+
+        if (code == SS_TAP_CODE) {
+            send_string_tap_code(keycode);
+        } else if (code == SS_DOWN_CODE) {
+            send_string_register_code(keycode);
+        } else {
+            send_string_unregister_code(keycode);
+        }
+    } else if (code == SS_DELAY_CODE) {
+        uint16_t ms = 0;
+        char     digit;
+
+        while (isdigit(digit = reader(string))) {
+            ms *= 10;
+            ms += digit - '0';
+            ++string;
+        }
+        // Skip the terminator
+        if (digit) {
+            ++string;
+        }
+        send_string_wait(ms);
+    }
+
+    send_string_wait(interval);
+    return string;
+}
+
+static void send_string_async_refill(void) {
+    while (stream_active) {
+        if (!stream_reader(stream_string)) {
+            if (stream_callback) {
+                if (send_string_async_available() < SEND_STRING_ASYNC_CALLBACK_ENTRIES) {
+                    return;
+                }
+                queue_callback(stream_callback, stream_context);
+            }
+            queue_tail    = queue_write;
+            stream_active = false;
+            return;
+        }
+
+        if (send_string_async_available() < SEND_STRING_ASYNC_CHAR_ENTRIES) {
+            return;
+        }
+        capture_depth++;
+        stream_string = send_string_async_decode(stream_string, stream_interval, stream_reader);
+        capture_depth--;
+        queue_tail = queue_write;
+    }
+}
+
+bool send_string_async_with_reader(const char *string, uint8_t interval, send_string_async_reader_t reader, send_string_async_callback_t callback, void *context) {
+    if (stream_active || capture_depth) {
+        return false;
+    }
+
+    stream_active   = true;
+    stream_string   = string;
+    stream_interval = interval;
+    stream_reader   = reader;
+    stream_callback = callback;
+    stream_context  = context;
+    send_string_async_refill();
+    return true;
+}
+
+bool send_string_async(const char *string, uint8_t interval, send_string_async_callback_t callback, void *context) {
+    return send_string_async_with_reader(string, interval, send_string_async_read, callback, context);
+}
+
+#    if defined(__AVR__)
+bool send_string_async_P(const char *string, uint8_t interval, send_string_async_callback_t callback, void *context) {
+    return send_string_async_with_reader(string, interval, send_string_async_read_P, callback, context);
+}
+#    endif
+
+void send_string_async_begin(void) {
+    if (!capture_depth) {
+        queue_overflow = false;
+    }
+    capture_depth++;
+}
+
+bool send_string_async_end(send_string_async_callback_t callback, void *context) {
+    if (!capture_depth) {
+        return false;
+    }
+
+    if (callback) {
+        queue_callback(callback, context);
+    }
+    if (--capture_depth) {
+        return !queue_overflow;
+    }
+
+    // Anything queued now would overtake the rest of the string being streamed
+    if (queue_overflow || stream_active) {
+        queue_write = queue_tail;
+        return false;
+    }
+    queue_tail = queue_write;
+    return true;
+}
+
+bool send_string_async_busy(void) {
+    return stream_active || queue_head != queue_tail;
+}
+
+uint16_t send_string_async_available(void) {
+    return (queue_head + SEND_STRING_ASYNC_QUEUE_SIZE - queue_write - 1) % SEND_STRING_ASYNC_QUEUE_SIZE;
+}
+
+void send_string_task(void) {
+    send_string_async_refill();
+
+    while (queue_head != queue_tail) {
+        if (timer_elapsed(last_send_time) < next_delay_ms) {
+            return;
+        }
+
+        send_string_async_entry_t *entry = &queue[queue_head];
+        queue_head                       = queue_next(queue_head);
+
+        switch (entry->action) {
+            case SEND_STRING_ASYNC_REGISTER:
+            case SEND_STRING_ASYNC_UNREGISTER:
+                if (entry->action == SEND_STRING_ASYNC_REGISTER) {
+                    register_code16(entry->keycode);
+                } else {
+                    unregister_code16(entry->keycode);
+                }
+                last_send_time = timer_read();
+                next_delay_ms  = MAX(entry->delay_ms, SEND_STRING_ASYNC_REPORT_INTERVAL);
+                break;
+            case SEND_STRING_ASYNC_DELAY:
+                last_send_time = timer_read();
+                next_delay_ms  = entry->delay_ms;
+                break;
+            case SEND_STRING_ASYNC_SET_MODS:
+                set_mods(entry->keycode);
+                break;
+            case SEND_STRING_ASYNC_CLEAR_WEAK_MODS:
+                clear_weak_mods();
+                break;
+            case SEND_STRING_ASYNC_CALLBACK: {
+                send_string_async_callback_t callback = entry->callback;
+                void                        *context  = queue[queue_head].context;
+
+                // Skip the context entry before the callback gets a chance to queue more
+                queue_head = queue_next(queue_head);
+                callback(context);
+                break;
+            }
+        }
+    }
+}
+#endif
@@ -23,6 +23,7 @@
  * \{
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "progmem.h"
@@ -147,6 +148,143 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
 #    define send_string_with_delay_P(string, interval) send_string_with_delay(string, interval)
 #endif
 
+/**
+ * \brief Press a keycode, which may include modifiers.
+ *
+ * Like `register_code16()`, except that it is queued instead when called between `send_string_async_begin()` and `send_string_async_end()`.
+ *
+ * \param keycode The keycode to press.
+ */
+void send_string_register_code(uint16_t keycode);
+
+/**
+ * \brief Release a keycode, which may include modifiers.
+ *
+ * Like `unregister_code16()`, except that it is queued instead when called between `send_string_async_begin()` and `send_string_async_end()`.
+ *
+ * \param keycode The keycode to release.
+ */
+void send_string_unregister_code(uint16_t keycode);
+
+/**
+ * \brief Tap a keycode, which may include modifiers.
+ *
+ * Like `tap_code16()`, except that it is queued instead when called between `send_string_async_begin()` and `send_string_async_end()`.
+ *
+ * \param keycode The keycode to tap.
+ */
+void send_string_tap_code(uint16_t keycode);
+
+/**
+ * \brief Wait before sending anything else.
+ *
+ * Like `wait_ms()`, except that it is queued instead when called between `send_string_async_begin()` and `send_string_async_end()`.
+ *
+ * \param ms The amount of time to wait, in milliseconds.
+ */
+void send_string_wait(uint16_t ms);
+
+/**
+ * \brief Replace the currently registered modifiers.
+ *
+ * Like `set_mods()`, except that it is queued instead when called between `send_string_async_begin()` and `send_string_async_end()`.
+ *
+ * \param mods A bitfield of modifiers.
+ */
+void send_string_set_mods(uint8_t mods);
+
+/**
+ * \brief Clear the weak modifiers.
+ *
+ * Like `clear_weak_mods()`, except that it is queued instead when called between `send_string_async_begin()` and `send_string_async_end()`.
+ */
+void send_string_clear_weak_mods(void);
+
+#if defined(SEND_STRING_ASYNC_ENABLE) || defined(__DOXYGEN__)
+/**
+ * \brief Called once everything queued before it has been sent.
+ */
+typedef void (*send_string_async_callback_t)(void *context);
+
+/**
+ * \brief Reads one byte of a string passed to `send_string_async_with_reader()`.
+ */
+typedef char (*send_string_async_reader_t)(const char *ptr);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out from the main loop.
+ *
+ * The string is decoded into the queue as room becomes available, so it must remain valid until `callback` is called.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ * \param callback An optional function to call once the whole string has been typed.
+ * \param context Passed to `callback`.
+ *
+ * \return false if the previous string has not been fully queued yet, in which case nothing is queued
+ */
+bool send_string_async(const char *string, uint8_t interval, send_string_async_callback_t callback, void *context);
+
+/**
+ * \brief Queue a string, read through `reader`, to be typed out from the main loop.
+ *
+ * This allows strings stored in PROGMEM or EEPROM to be streamed into the queue.
+ *
+ * \return false if the previous string has not been fully queued yet, in which case nothing is queued
+ */
+bool send_string_async_with_reader(const char *string, uint8_t interval, send_string_async_reader_t reader, send_string_async_callback_t callback, void *context);
+
+#    if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out from the main loop.
+ *
+ * On ARM devices, this function is simply an alias for send_string_async(string, interval, callback, context).
+ */
+bool send_string_async_P(const char *string, uint8_t interval, send_string_async_callback_t callback, void *context);
+#    else
+#        define send_string_async_P(string, interval, callback, context) send_string_async(string, interval, callback, context)
+#    endif
+
+/**
+ * \brief Start queueing everything sent through the Send String API, instead of sending it straight away.
+ *
+ * This also captures the Unicode functions, which are built on the same API.
+ */
+void send_string_async_begin(void);
+
+/**
+ * \brief Stop queueing, and hand everything queued since `send_string_async_begin()` to the main loop.
+ *
+ * \param callback An optional function to call once everything has been sent.
+ * \param context Passed to `callback`.
+ *
+ * \return false if the queue did not have room, or a string passed to `send_string_async()` has not been fully queued yet; in both cases nothing is queued
+ */
+bool send_string_async_end(send_string_async_callback_t callback, void *context);
+
+/**
+ * \brief Returns whether anything is still waiting to be sent.
+ */
+bool send_string_async_busy(void);
+
+/**
+ * \brief Returns the number of free queue entries.
+ *
+ * Each key press or release takes one entry, as does each callback. Waits are merged into the preceding entry where possible.
+ */
+uint16_t send_string_async_available(void);
+
+/**
+ * \brief Sends the queued keystrokes which are due. Called from the main loop.
+ */
+void send_string_task(void);
+
+/**
+ * \brief Shortcut macro for send_string_async_P(PSTR(string), 0, NULL, NULL).
+ */
+#    define SEND_STRING_ASYNC(string) send_string_async_P(PSTR(string), 0, NULL, NULL)
+#endif
+
 /**
  * \brief Shortcut macro for send_string_with_delay_P(PSTR(string), 0).
  *
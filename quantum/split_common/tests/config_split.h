@@ -0,0 +1,8 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 8
+#define MATRIX_COLS 6
+
+#define FORCED_SYNC_THROTTLE_MS 100
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+// A wide matrix, so that the mirrored master matrix is large enough for batching to pay off
+#define MATRIX_ROWS 12
+#define MATRIX_COLS 32
+
+#define FORCED_SYNC_THROTTLE_MS 100
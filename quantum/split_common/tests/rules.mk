@@ -0,0 +1,34 @@
+split_batching_DEFS := -DSPLIT_KEYBOARD -DSPLIT_LAYER_STATE_ENABLE -DSPLIT_LED_STATE_ENABLE -DSPLIT_TRANSPORT_MIRROR -DSPLIT_TRANSACTION_BATCHING
+split_batching_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_split_batching.h
+split_batching_INC := \
+	$(QUANTUM_PATH)/split_common \
+	$(DRIVER_PATH)
+split_batching_SRC := \
+	platforms/test/timer.c \
+	platforms/synchronization_util.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/sync_timer.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/tests/split_batching_tests.cpp
+
+split_sim_DEFS := -DSPLIT_KEYBOARD -DSPLIT_LAYER_STATE_ENABLE -DSPLIT_LED_STATE_ENABLE
+split_sim_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_split.h
+split_sim_INC := \
+	$(QUANTUM_PATH)/split_common \
+	$(QUANTUM_PATH)/split_common/tests \
+	$(DRIVER_PATH)
+split_sim_SRC := \
+	platforms/test/timer.c \
+	platforms/synchronization_util.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/sync_timer.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/tests/split_sim.c \
+	$(QUANTUM_PATH)/split_common/tests/split_sim_tests.cpp
+
+split_sim_batching_DEFS := $(split_sim_DEFS) -DSPLIT_TRANSACTION_BATCHING
+split_sim_batching_CONFIG := $(split_sim_CONFIG)
+split_sim_batching_INC := $(split_sim_INC)
+split_sim_batching_SRC := $(split_sim_SRC)
@@ -0,0 +1,268 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "crc.h"
+#include "serial.h"
+#include "timer.h"
+#include "transactions.h"
+#include "transport.h"
+
+void advance_time(uint32_t ms);
+
+layer_state_t layer_state;
+layer_state_t default_layer_state;
+
+bool is_keyboard_master(void) {
+    return true;
+}
+
+bool is_keyboard_left(void) {
+    return true;
+}
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+uint8_t host_keyboard_leds(void) {
+    return 0;
+}
+
+void set_split_host_keyboard_leds(uint8_t led_state) {}
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+}
+
+namespace {
+
+enum class Link { ok, drop, corrupt, lose_response };
+
+struct Transaction {
+    int8_t            id;
+    split_batch_m2s_t frame; // the frame put on the wire, for batch transactions
+};
+
+split_shared_memory_t    slave_shmem;
+int                      failures_left = 0; // the next transactions to fail
+Link                     failure       = Link::ok;
+std::vector<Transaction> transactions;
+
+bool is_batch(int8_t id) {
+    return id == EXCHANGE_BATCH_QUARTER || id == EXCHANGE_BATCH_HALF || id == EXCHANGE_BATCH;
+}
+
+} // namespace
+
+// Delivers the transactions to a slave with its own copy of the shared memory
+extern "C" bool soft_serial_transaction(int sstd_index) {
+    split_transaction_desc_t *trans = &split_transaction_table[sstd_index];
+    Transaction               record{(int8_t)sstd_index, {}};
+    if (is_batch(sstd_index)) {
+        memcpy(&record.frame, &split_shmem->batch_m2s, trans->initiator2target_buffer_size);
+    }
+    transactions.push_back(record);
+
+    // Failures are only injected into what the master sends, not into reading the slave matrix
+    Link link = Link::ok;
+    if (failures_left > 0 && sstd_index != GET_SLAVE_MATRIX_CHECKSUM && sstd_index != GET_SLAVE_MATRIX_DATA) {
+        link = failure;
+        --failures_left;
+    }
+    if (link == Link::drop) {
+        return false;
+    }
+
+    memcpy(((uint8_t *)&slave_shmem) + trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+    if (link == Link::corrupt) {
+        slave_shmem.batch_m2s.data[0] ^= 0x55;
+    }
+    if (trans->slave_callback) {
+        static split_shared_memory_t master_shmem;
+        memcpy(&master_shmem, split_shmem, sizeof(master_shmem));
+        memcpy(split_shmem, &slave_shmem, sizeof(slave_shmem));
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        memcpy(&slave_shmem, split_shmem, sizeof(slave_shmem));
+        memcpy(split_shmem, &master_shmem, sizeof(master_shmem));
+    }
+    if (link == Link::lose_response) {
+        return false;
+    }
+
+    memcpy(split_trans_target2initiator_buffer(trans), ((const uint8_t *)&slave_shmem) + trans->target2initiator_offset, trans->target2initiator_buffer_size);
+    return true;
+}
+
+namespace {
+
+struct Record {
+    uint8_t              start;
+    std::vector<uint8_t> data;
+};
+
+// Finds the record for transaction `id` in a batch frame
+bool find_record(const split_batch_m2s_t &frame, int8_t id, Record *record) {
+    uint8_t pos = 0;
+    while (pos + SPLIT_BATCH_RECORD_HEADER_SIZE <= frame.length) {
+        uint8_t len = frame.data[pos + 2];
+        if (frame.data[pos] == id) {
+            record->start = frame.data[pos + 1];
+            record->data.assign(&frame.data[pos + SPLIT_BATCH_RECORD_HEADER_SIZE], &frame.data[pos + SPLIT_BATCH_RECORD_HEADER_SIZE + len]);
+            return true;
+        }
+        pos += SPLIT_BATCH_RECORD_HEADER_SIZE + len;
+    }
+    return false;
+}
+
+class SplitBatching : public ::testing::Test {
+   protected:
+    matrix_row_t master_matrix[MATRIX_ROWS / 2] = {0};
+
+    void SetUp() override {
+        failures_left = 0;
+        // The slave publishes an idle matrix, as transactions_slave() would
+        slave_shmem.smatrix.checksum = crc8(slave_shmem.smatrix.matrix, sizeof(slave_shmem.smatrix.matrix));
+        // Force a full sync, so the slave has acknowledged everything before the test starts
+        advance_time(FORCED_SYNC_THROTTLE_MS);
+        for (int i = 0; i < 3; ++i) {
+            scan();
+        }
+        transactions.clear();
+    }
+
+    bool scan() {
+        matrix_row_t slave_matrix[MATRIX_ROWS / 2] = {0};
+        bool         okay                           = transactions_master(master_matrix, slave_matrix);
+        advance_time(1);
+        return okay;
+    }
+
+    void fail_next(int count, Link link) {
+        failures_left = count;
+        failure       = link;
+    }
+
+    // The transactions sent in the last scan, other than reading the slave matrix
+    std::vector<Transaction> sent() {
+        std::vector<Transaction> result;
+        for (const Transaction &t : transactions) {
+            if (t.id != GET_SLAVE_MATRIX_CHECKSUM && t.id != GET_SLAVE_MATRIX_DATA) {
+                result.push_back(t);
+            }
+        }
+        transactions.clear();
+        return result;
+    }
+};
+
+TEST_F(SplitBatching, SmallChangesAreSentOnTheirOwn) {
+    // A frame costs more than a single layer state transaction
+    layer_state ^= 0x01;
+    EXPECT_TRUE(scan());
+    auto result = sent();
+    ASSERT_EQ(result.size(), 1u);
+    EXPECT_EQ(result[0].id, PUT_LAYER_STATE);
+    EXPECT_EQ(slave_shmem.layers.layer_state, layer_state);
+}
+
+TEST_F(SplitBatching, SendsOnlyChangedBytesInSmallestFrame) {
+    master_matrix[2] ^= 0x00FF0000;
+    EXPECT_TRUE(scan());
+    auto result = sent();
+    ASSERT_EQ(result.size(), 1u);
+    EXPECT_EQ(result[0].id, EXCHANGE_BATCH_QUARTER);
+
+    Record record;
+    ASSERT_TRUE(find_record(result[0].frame, PUT_MASTER_MATRIX, &record));
+    EXPECT_EQ(record.start, 2 * sizeof(matrix_row_t) + 2);
+    EXPECT_EQ(record.data, std::vector<uint8_t>{0xFF});
+    EXPECT_EQ(result[0].frame.checksum, crc8(&result[0].frame.sequence, result[0].frame.length + 2));
+    EXPECT_EQ(memcmp(slave_shmem.mmatrix.matrix, master_matrix, sizeof(master_matrix)), 0);
+}
+
+TEST_F(SplitBatching, ChangesShareOneFrame) {
+    master_matrix[0] ^= 0x01;
+    layer_state ^= 0x02;
+    default_layer_state ^= 0x02;
+    EXPECT_TRUE(scan());
+    auto result = sent();
+    ASSERT_EQ(result.size(), 1u);
+    ASSERT_TRUE(is_batch(result[0].id));
+
+    Record record;
+    EXPECT_TRUE(find_record(result[0].frame, PUT_MASTER_MATRIX, &record));
+    EXPECT_TRUE(find_record(result[0].frame, PUT_LAYER_STATE, &record));
+    EXPECT_TRUE(find_record(result[0].frame, PUT_DEFAULT_LAYER_STATE, &record));
+    EXPECT_EQ(slave_shmem.layers.layer_state, layer_state);
+    EXPECT_EQ(slave_shmem.layers.default_layer_state, default_layer_state);
+}
+
+TEST_F(SplitBatching, UnchangedStateIsNotResent) {
+    master_matrix[1] ^= 0x04;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(sent().size(), 1u);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(sent().size(), 0u);
+}
+
+TEST_F(SplitBatching, DroppedFrameIsResentInFull) {
+    master_matrix[1] ^= 0x08;
+    fail_next(1, Link::drop);
+    // The failed exchange is retried within the same scan, without a delta as the slave's state is unknown
+    EXPECT_TRUE(scan());
+    auto result = sent();
+    ASSERT_EQ(result.size(), 2u);
+    EXPECT_TRUE(is_batch(result[0].id));
+    EXPECT_EQ(result[1].id, PUT_MASTER_MATRIX);
+    EXPECT_EQ(memcmp(slave_shmem.mmatrix.matrix, master_matrix, sizeof(master_matrix)), 0);
+}
+
+TEST_F(SplitBatching, CorruptedFrameIsRejected) {
+    master_matrix[1] ^= 0x10;
+    fail_next(1, Link::corrupt);
+    // The slave doesn't echo the sequence of a frame that fails its checksum, so the master retries it
+    EXPECT_TRUE(scan());
+    auto result = sent();
+    ASSERT_EQ(result.size(), 2u);
+    EXPECT_TRUE(is_batch(result[0].id));
+    EXPECT_EQ(memcmp(slave_shmem.mmatrix.matrix, master_matrix, sizeof(master_matrix)), 0);
+}
+
+TEST_F(SplitBatching, LostResponseDoesNotLeaveSlaveStale) {
+    const matrix_row_t original = master_matrix[3];
+
+    // The slave applies the change, but the master never hears back
+    master_matrix[3] ^= 0x20;
+    fail_next(10, Link::lose_response);
+    EXPECT_FALSE(scan());
+    EXPECT_EQ(slave_shmem.mmatrix.matrix[3], master_matrix[3]);
+
+    // Going back to the last acknowledged value must still reach the slave
+    master_matrix[3] = original;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_shmem.mmatrix.matrix[3], original);
+}
+
+TEST_F(SplitBatching, ForcedSyncSendsFullState) {
+    advance_time(FORCED_SYNC_THROTTLE_MS);
+    EXPECT_TRUE(scan());
+
+    // Everything is resent in full, on its own
+    bool layer_state_sent = false;
+    for (const Transaction &t : sent()) {
+        Record record;
+        if (t.id == PUT_LAYER_STATE || (is_batch(t.id) && find_record(t.frame, PUT_LAYER_STATE, &record))) {
+            layer_state_sent = true;
+        }
+    }
+    EXPECT_TRUE(layer_state_sent);
+}
+
+} // namespace
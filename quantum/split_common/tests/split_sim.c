@@ -0,0 +1,193 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "split_sim.h"
+#include "serial.h"
+#include "transactions.h"
+#include "transport.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+
+#define SPLIT_SIM_NO_ROLE ((split_sim_role_t)-1)
+
+static split_sim_link_t      link;
+static uint32_t              scan_time_us;
+static uint64_t              now_us;
+static uint32_t              rng_state;
+static split_sim_stats_t     stats;
+static split_sim_half_t      halves[2];
+static split_shared_memory_t shmem[2]; // each half's shared memory, while the other half is running
+static split_sim_role_t      current_role = SPLIT_SIM_NO_ROLE;
+
+layer_state_t layer_state;
+layer_state_t default_layer_state;
+
+////////////////////////////////////////////////////
+// Halves
+
+static void save_role(void) {
+    if (current_role == SPLIT_SIM_NO_ROLE) {
+        return;
+    }
+    memcpy(&shmem[current_role], split_shmem, sizeof(split_shared_memory_t));
+    halves[current_role].layer_state         = layer_state;
+    halves[current_role].default_layer_state = default_layer_state;
+    current_role                             = SPLIT_SIM_NO_ROLE;
+}
+
+static void load_role(split_sim_role_t role) {
+    save_role();
+    memcpy(split_shmem, &shmem[role], sizeof(split_shared_memory_t));
+    layer_state         = halves[role].layer_state;
+    default_layer_state = halves[role].default_layer_state;
+    current_role        = role;
+}
+
+bool is_keyboard_master(void) {
+    return current_role != SPLIT_SIM_SLAVE;
+}
+
+bool is_keyboard_left(void) {
+    return is_keyboard_master();
+}
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+uint8_t host_keyboard_leds(void) {
+    return halves[SPLIT_SIM_MASTER].led_state;
+}
+
+void set_split_host_keyboard_leds(uint8_t led_state) {
+    halves[SPLIT_SIM_SLAVE].led_state = led_state;
+}
+
+////////////////////////////////////////////////////
+// Link
+
+static void advance_us(uint32_t us) {
+    uint32_t last_ms = now_us / 1000;
+    now_us += us;
+    advance_time(now_us / 1000 - last_ms);
+}
+
+static uint32_t next_random(void) {
+    // xorshift32
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static bool corrupted(uint16_t bytes) {
+    if (link.error_rate_ppm == 0) {
+        return false;
+    }
+    bool any = false;
+    for (uint16_t i = 0; i < bytes; ++i) {
+        any |= (next_random() % 1000000) < link.error_rate_ppm;
+    }
+    return any;
+}
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+// Runs a transaction from the master's shared memory to the slave's, failing it as a framing or parity error would if any byte is corrupted
+bool soft_serial_transaction(int sstd_index) {
+    split_transaction_desc_t *trans     = &split_transaction_table[sstd_index];
+    uint16_t                  i2t_bytes = 1 + trans->initiator2target_buffer_size;
+    uint16_t                  t2i_bytes = trans->target2initiator_buffer_size;
+    uint32_t                  link_us   = link.latency_us + (uint32_t)(((uint64_t)(i2t_bytes + t2i_bytes) * 10 * 1000000) / link.baud_rate);
+
+    stats.transactions++;
+    stats.bytes += i2t_bytes + t2i_bytes;
+    stats.link_time_us += link_us;
+    advance_us(link_us);
+
+    if (corrupted(i2t_bytes)) {
+        stats.failed_transactions++;
+        return false;
+    }
+
+    memcpy(((uint8_t *)&shmem[SPLIT_SIM_SLAVE]) + trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+    if (trans->slave_callback) {
+        load_role(SPLIT_SIM_SLAVE);
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        load_role(SPLIT_SIM_MASTER);
+    }
+
+    if (corrupted(t2i_bytes)) {
+        stats.failed_transactions++;
+        return false;
+    }
+
+    memcpy(split_trans_target2initiator_buffer(trans), ((const uint8_t *)&shmem[SPLIT_SIM_SLAVE]) + trans->target2initiator_offset, trans->target2initiator_buffer_size);
+    return true;
+}
+
+////////////////////////////////////////////////////
+// Simulation
+
+void split_sim_init(const split_sim_link_t *config, uint32_t scan_time) {
+    save_role();
+    memcpy(&link, config, sizeof(link));
+    scan_time_us = scan_time;
+    now_us       = 0;
+    rng_state    = link.seed ? link.seed : 1;
+    memset(halves, 0, sizeof(halves));
+    memset(shmem, 0, sizeof(shmem));
+    memset(&stats, 0, sizeof(stats));
+    timer_clear();
+}
+
+bool split_sim_scan(void) {
+    split_sim_half_t *master = &halves[SPLIT_SIM_MASTER];
+    split_sim_half_t *slave  = &halves[SPLIT_SIM_SLAVE];
+
+    load_role(SPLIT_SIM_SLAVE);
+    transactions_slave(slave->other_matrix, slave->matrix);
+
+    load_role(SPLIT_SIM_MASTER);
+    bool okay = transactions_master(master->matrix, master->other_matrix);
+    save_role();
+
+    stats.scans++;
+    if (!okay) {
+        stats.failed_scans++;
+    }
+    advance_us(scan_time_us);
+    return okay;
+}
+
+void split_sim_set_key(split_sim_role_t role, uint8_t row, uint8_t col, bool pressed) {
+    if (pressed) {
+        halves[role].matrix[row] |= (matrix_row_t)1 << col;
+    } else {
+        halves[role].matrix[row] &= ~((matrix_row_t)1 << col);
+    }
+}
+
+bool split_sim_master_sees_slave_key(uint8_t row, uint8_t col) {
+    return halves[SPLIT_SIM_MASTER].other_matrix[row] & ((matrix_row_t)1 << col);
+}
+
+split_sim_half_t *split_sim_half(split_sim_role_t role) {
+    return &halves[role];
+}
+
+uint64_t split_sim_time_us(void) {
+    return now_us;
+}
+
+const split_sim_stats_t *split_sim_stats(void) {
+    return &stats;
+}
+
+void split_sim_reset_stats(void) {
+    memset(&stats, 0, sizeof(stats));
+}
@@ -0,0 +1,63 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "matrix.h"
+#include "action_layer.h"
+
+/**
+ * Host-side model of a split keyboard, running the master and the slave halves in one process.
+ *
+ * The simulator implements the soft_serial driver used by the split transport, so the real
+ * transactions run over a link with configurable bandwidth, latency and error rate. Each half
+ * has its own copy of the shared memory and of the state the transactions synchronise, which
+ * is swapped in whenever code runs on that half.
+ */
+
+#define SPLIT_SIM_ROWS ((MATRIX_ROWS) / 2)
+
+typedef enum split_sim_role_t {
+    SPLIT_SIM_MASTER,
+    SPLIT_SIM_SLAVE,
+} split_sim_role_t;
+
+typedef struct split_sim_link_t {
+    uint32_t baud_rate;      // link bandwidth in bits per second, at 10 bits per byte as for 8N1 serial
+    uint32_t latency_us;     // fixed turnaround time added to each transaction
+    uint32_t error_rate_ppm; // probability of each byte being corrupted, in parts per million
+    uint32_t seed;           // seed for the error generator, so that runs are repeatable
+} split_sim_link_t;
+
+typedef struct split_sim_stats_t {
+    uint32_t scans;
+    uint32_t transactions;
+    uint32_t failed_transactions;
+    uint32_t failed_scans; // scans where transactions_master() reported a failure
+    uint32_t bytes;        // bytes on the wire in both directions, including the transaction ID
+    uint64_t link_time_us; // time spent with the link busy
+} split_sim_stats_t;
+
+typedef struct split_sim_half_t {
+    matrix_row_t  matrix[SPLIT_SIM_ROWS];       // this half's own keys
+    matrix_row_t  other_matrix[SPLIT_SIM_ROWS]; // the other half's keys, as seen from this half
+    layer_state_t layer_state;
+    layer_state_t default_layer_state;
+    uint8_t       led_state;
+} split_sim_half_t;
+
+void split_sim_init(const split_sim_link_t *link, uint32_t scan_time_us);
+
+// Runs one scan of the slave followed by one scan of the master, then advances time by the scan time
+bool split_sim_scan(void);
+
+void split_sim_set_key(split_sim_role_t role, uint8_t row, uint8_t col, bool pressed);
+bool split_sim_master_sees_slave_key(uint8_t row, uint8_t col);
+
+// State of each half; changes to the current role's copy should be made through split_sim_set_key or between scans
+split_sim_half_t *split_sim_half(split_sim_role_t role);
+
+uint64_t                 split_sim_time_us(void);
+const split_sim_stats_t *split_sim_stats(void);
+void                     split_sim_reset_stats(void);
@@ -0,0 +1,146 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "split_sim.h"
+}
+
+static const split_sim_link_t default_link = {
+    .baud_rate      = 1000000,
+    .latency_us     = 20,
+    .error_rate_ppm = 0,
+    .seed           = 0x2545F491,
+};
+
+class SplitSim : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        init(default_link);
+    }
+
+    void init(const split_sim_link_t &link, uint32_t scan_time_us = 1000) {
+        split_sim_init(&link, scan_time_us);
+        // Let the initial full syncs settle
+        for (int i = 0; i < 10; ++i) {
+            split_sim_scan();
+        }
+        split_sim_reset_stats();
+    }
+
+    // Presses a key on the slave, and returns how long it took for the master to see it
+    uint64_t slave_key_latency_us(uint8_t row, uint8_t col, int max_scans = 100) {
+        uint64_t pressed_at = split_sim_time_us();
+        split_sim_set_key(SPLIT_SIM_SLAVE, row, col, true);
+        for (int i = 0; i < max_scans && !split_sim_master_sees_slave_key(row, col); ++i) {
+            split_sim_scan();
+        }
+        EXPECT_TRUE(split_sim_master_sees_slave_key(row, col)) << "Key press never reached the master";
+        uint64_t latency = split_sim_time_us() - pressed_at;
+
+        split_sim_set_key(SPLIT_SIM_SLAVE, row, col, false);
+        for (int i = 0; i < max_scans && split_sim_master_sees_slave_key(row, col); ++i) {
+            split_sim_scan();
+        }
+        EXPECT_FALSE(split_sim_master_sees_slave_key(row, col)) << "Key release never reached the master";
+        return latency;
+    }
+
+    void record_traffic(const char *prefix) {
+        const split_sim_stats_t *stats = split_sim_stats();
+        RecordProperty(std::string(prefix) + "_bytes_per_scan", std::to_string((double)stats->bytes / stats->scans));
+        RecordProperty(std::string(prefix) + "_transactions_per_scan", std::to_string((double)stats->transactions / stats->scans));
+        RecordProperty(std::string(prefix) + "_link_us_per_scan", std::to_string((double)stats->link_time_us / stats->scans));
+    }
+};
+
+TEST_F(SplitSim, SlaveKeysReachMaster) {
+    for (uint8_t row = 0; row < SPLIT_SIM_ROWS; ++row) {
+        for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+            slave_key_latency_us(row, col);
+        }
+    }
+    EXPECT_EQ(split_sim_stats()->failed_scans, 0u);
+}
+
+TEST_F(SplitSim, MasterStateReachesSlave) {
+    split_sim_half(SPLIT_SIM_MASTER)->layer_state         = 0x0C;
+    split_sim_half(SPLIT_SIM_MASTER)->default_layer_state = 0x02;
+    split_sim_half(SPLIT_SIM_MASTER)->led_state           = 0x02;
+
+    // Sent by the master on one scan, and applied by the slave on its next
+    split_sim_scan();
+    split_sim_scan();
+
+    EXPECT_EQ(split_sim_half(SPLIT_SIM_SLAVE)->layer_state, 0x0Cu);
+    EXPECT_EQ(split_sim_half(SPLIT_SIM_SLAVE)->default_layer_state, 0x02u);
+    EXPECT_EQ(split_sim_half(SPLIT_SIM_SLAVE)->led_state, 0x02);
+
+    // The master's own copies are left untouched by the slave running
+    EXPECT_EQ(split_sim_half(SPLIT_SIM_MASTER)->layer_state, 0x0Cu);
+}
+
+TEST_F(SplitSim, IdleTraffic) {
+    for (int i = 0; i < 1000; ++i) {
+        split_sim_scan();
+    }
+    const split_sim_stats_t *stats = split_sim_stats();
+    EXPECT_EQ(stats->scans, 1000u);
+    EXPECT_EQ(stats->failed_scans, 0u);
+    EXPECT_GT(stats->transactions, 0u);
+    record_traffic("idle");
+}
+
+TEST_F(SplitSim, TypingTraffic) {
+    uint64_t total_latency = 0;
+    int      presses       = 0;
+    for (int i = 0; i < 200; ++i) {
+        uint8_t row = i % SPLIT_SIM_ROWS;
+        uint8_t col = (i * 7) % MATRIX_COLS;
+        // Change the master state every so often, as layer keys and lock keys would
+        if (i % 10 == 0) {
+            split_sim_half(SPLIT_SIM_MASTER)->layer_state ^= 0x02;
+        }
+        total_latency += slave_key_latency_us(row, col);
+        presses++;
+    }
+    EXPECT_EQ(split_sim_stats()->failed_scans, 0u);
+    record_traffic("typing");
+    RecordProperty("typing_key_latency_us", std::to_string((double)total_latency / presses));
+}
+
+TEST_F(SplitSim, SlowLinkIncreasesLatency) {
+    uint64_t fast = slave_key_latency_us(0, 0);
+
+    split_sim_link_t slow = default_link;
+    slow.baud_rate        = 9600;
+    slow.latency_us       = 500;
+    init(slow);
+    uint64_t slow_latency = slave_key_latency_us(0, 0);
+
+    EXPECT_GT(slow_latency, fast);
+    RecordProperty("fast_key_latency_us", std::to_string(fast));
+    RecordProperty("slow_key_latency_us", std::to_string(slow_latency));
+}
+
+TEST_F(SplitSim, RecoversFromLinkErrors) {
+    split_sim_link_t noisy = default_link;
+    noisy.error_rate_ppm   = 2000;
+    init(noisy);
+
+    for (int i = 0; i < 100; ++i) {
+        split_sim_half(SPLIT_SIM_MASTER)->layer_state = 1 << (i % 8);
+        slave_key_latency_us(i % SPLIT_SIM_ROWS, i % MATRIX_COLS);
+    }
+    // The layer state is resent until it gets through
+    for (int i = 0; i < 10; ++i) {
+        split_sim_scan();
+    }
+
+    EXPECT_GT(split_sim_stats()->failed_transactions, 0u);
+    EXPECT_EQ(split_sim_half(SPLIT_SIM_SLAVE)->layer_state, split_sim_half(SPLIT_SIM_MASTER)->layer_state);
+    RecordProperty("noisy_failed_transactions", std::to_string(split_sim_stats()->failed_transactions));
+    RecordProperty("noisy_failed_scans", std::to_string(split_sim_stats()->failed_scans));
+}
@@ -0,0 +1,4 @@
+TEST_LIST += \
+	split_batching \
+	split_sim \
+	split_sim_batching
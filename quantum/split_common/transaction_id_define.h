@@ -16,6 +16,10 @@
 
 #pragma once
 
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
 enum serial_transaction_id {
 #ifdef USE_I2C
     I2C_EXECUTE_CALLBACK,
@@ -24,6 +28,12 @@ enum serial_transaction_id {
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
 
+#ifdef SPLIT_TRANSACTION_BATCHING
+    EXCHANGE_BATCH_QUARTER,
+    EXCHANGE_BATCH_HALF,
+    EXCHANGE_BATCH,
+#endif // SPLIT_TRANSACTION_BATCHING
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -84,7 +84,15 @@
 #define trans_initiator2target_cb(cb) \
     { 0, 0, 0, 0, cb }
 
-#define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
+#define trans_exchange_initializer_cb(initiator2target_member, target2initiator_member, cb) \
+    { sizeof_member(split_shared_memory_t, initiator2target_member), offsetof(split_shared_memory_t, initiator2target_member), sizeof_member(split_shared_memory_t, target2initiator_member), offsetof(split_shared_memory_t, target2initiator_member), cb }
+
+#ifdef SPLIT_TRANSACTION_BATCHING
+static bool batch_stage(int8_t id, const void *data, uint16_t length);
+#    define transport_write(id, data, length) batch_stage(id, data, length)
+#else // SPLIT_TRANSACTION_BATCHING
+#    define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
+#endif // SPLIT_TRANSACTION_BATCHING
 #define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
 #define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
 
@@ -206,6 +214,236 @@ static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row
     [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
 // clang-format on
 
+////////////////////////////////////////////////////
+// Batched exchange
+
+#ifdef SPLIT_TRANSACTION_BATCHING
+
+_Static_assert(NUM_TOTAL_TRANSACTIONS <= 32, "Batched transactions are tracked in a 32-bit mask");
+_Static_assert(SPLIT_TRANSACTION_BATCH_SIZE >= 8 && SPLIT_TRANSACTION_BATCH_SIZE % 4 == 0, "SPLIT_TRANSACTION_BATCH_SIZE must be a multiple of 4, and at least 8");
+
+static uint32_t              batch_pending     = 0; // transactions staged since they were last acknowledged by the slave
+static uint32_t              batch_acked_valid = 0; // transactions whose acknowledged copy can be used as a delta baseline
+static split_shared_memory_t batch_acked;           // last state acknowledged by the slave, at the same offsets as split_shmem
+
+// Frames are sent with the smallest of these transactions that holds the encoded records
+static const int8_t batch_frame_ids[] = {EXCHANGE_BATCH_QUARTER, EXCHANGE_BATCH_HALF, EXCHANGE_BATCH};
+
+// Bytes a frame costs on top of its records: the transaction id, the frame header, and the response
+#    define BATCH_FRAME_OVERHEAD (1 + offsetof(split_batch_m2s_t, data) + sizeof(split_batch_s2m_t))
+
+static bool batch_can_stage(int8_t id) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+#    if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+    // RPC transactions are sequenced against each other, so must be sent as they're requested
+    if (id >= PUT_RPC_INFO && id <= GET_RPC_RESP_DATA) {
+        return false;
+    }
+#    endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+    // Anything needing a slave callback, or which would never fit in a frame, is still sent on its own
+    return !trans->slave_callback && trans->initiator2target_buffer_size + SPLIT_BATCH_RECORD_HEADER_SIZE <= SPLIT_TRANSACTION_BATCH_SIZE;
+}
+
+// Records that the slave now holds the staged data of the specified transactions
+static void batch_acknowledge(uint32_t mask) {
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; ++id) {
+        if (mask & (1UL << id)) {
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            memcpy(((uint8_t *)&batch_acked) + trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+        }
+    }
+#    if defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+    // The slave clears the change flags once it has acted on them
+    batch_acked.rgblight_sync.status.change_flags = 0;
+#    endif // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+    batch_pending &= ~mask;
+    batch_acked_valid |= mask;
+}
+
+// Finds the span of a staged transaction's bytes which differs from what the slave last acknowledged
+static uint8_t batch_delta(int8_t id, uint8_t *start) {
+    split_transaction_desc_t *trans   = &split_transaction_table[id];
+    const uint8_t            *current = split_trans_initiator2target_buffer(trans);
+    uint8_t                   end     = trans->initiator2target_buffer_size;
+    *start                            = 0;
+    if (batch_acked_valid & (1UL << id)) {
+        const uint8_t *acked = ((const uint8_t *)&batch_acked) + trans->initiator2target_offset;
+        while (*start < end && current[*start] == acked[*start]) {
+            ++*start;
+        }
+        while (end > *start && current[end - 1] == acked[end - 1]) {
+            --end;
+        }
+    }
+    return end - *start;
+}
+
+// Sends each changed transaction on its own, as without batching
+static bool batch_send_unbatched(void) {
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; ++id) {
+        uint32_t mask = 1UL << id;
+        if (!(batch_pending & mask)) {
+            continue;
+        }
+
+        uint8_t start;
+        if (batch_delta(id, &start) > 0) {
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            uint8_t                   data[SPLIT_TRANSACTION_BATCH_SIZE];
+            memcpy(data, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+            if (!transport_execute_transaction(id, data, trans->initiator2target_buffer_size, NULL, 0)) {
+                // The slave may or may not have applied it, so the next attempt must not be a delta
+                batch_acked_valid &= ~mask;
+                return false;
+            }
+        }
+        batch_acknowledge(mask);
+    }
+    return true;
+}
+
+static bool batch_stage(int8_t id, const void *data, uint16_t length) {
+    if (!batch_can_stage(id)) {
+        return transport_execute_transaction(id, data, length, NULL, 0);
+    }
+
+    // Write into the local shared memory, to be sent with the next batch
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    size_t                    len   = trans->initiator2target_buffer_size < length ? trans->initiator2target_buffer_size : length;
+    if (memcmp(split_trans_initiator2target_buffer(trans), data, len) == 0) {
+        // Unchanged data is only written for a forced sync, in case the slave has lost its state, so send it in full right away
+        if (!transport_execute_transaction(id, data, length, NULL, 0)) {
+            batch_acked_valid &= ~(1UL << id);
+            return false;
+        }
+        batch_acknowledge(1UL << id);
+        return true;
+    }
+    memcpy(split_trans_initiator2target_buffer(trans), data, len);
+    batch_pending |= (1UL << id);
+
+    // Unless a frame is already being built, a change which can't save more than a frame's overhead is sent on its own right away
+    uint8_t start;
+    uint8_t record_bytes = SPLIT_BATCH_RECORD_HEADER_SIZE + batch_delta(id, &start);
+    if (batch_pending == (1UL << id) && record_bytes + BATCH_FRAME_OVERHEAD >= 1 + trans->initiator2target_buffer_size) {
+        return batch_send_unbatched();
+    }
+    return true;
+}
+
+// Packs as many of the changed transactions as fit, returning those which were included, and the bytes they'd take if sent on their own
+static uint32_t batch_encode(split_batch_m2s_t *frame, uint16_t *unbatched_bytes) {
+    uint32_t encoded = 0;
+    frame->length    = 0;
+    *unbatched_bytes = 0;
+
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; ++id) {
+        uint32_t mask = 1UL << id;
+        if (!(batch_pending & mask)) {
+            continue;
+        }
+
+        uint8_t start;
+        uint8_t len = batch_delta(id, &start);
+        if (len > 0) {
+            if (frame->length + SPLIT_BATCH_RECORD_HEADER_SIZE + len > SPLIT_TRANSACTION_BATCH_SIZE) {
+                // Doesn't fit, leave it pending for the next frame
+                continue;
+            }
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            frame->data[frame->length++]    = id;
+            frame->data[frame->length++]    = start;
+            frame->data[frame->length++]    = len;
+            memcpy(&frame->data[frame->length], split_trans_initiator2target_buffer(trans) + start, len);
+            frame->length += len;
+            *unbatched_bytes += 1 + trans->initiator2target_buffer_size;
+        }
+        encoded |= mask;
+    }
+
+    return encoded;
+}
+
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint8_t sequence = 0;
+
+    if (!batch_pending) {
+        return true;
+    }
+
+    split_batch_m2s_t frame;
+    uint16_t          unbatched_bytes;
+    uint32_t          encoded = batch_encode(&frame, &unbatched_bytes);
+
+    // Only the used part of the frame's data is sent, rounded up to the next frame size
+    uint8_t frame_index = 0;
+    while (split_transaction_table[batch_frame_ids[frame_index]].initiator2target_buffer_size < offsetof(split_batch_m2s_t, data) + frame.length) {
+        ++frame_index;
+    }
+    split_transaction_desc_t *trans         = &split_transaction_table[batch_frame_ids[frame_index]];
+    uint16_t                  batched_bytes = 1 + trans->initiator2target_buffer_size + trans->target2initiator_buffer_size;
+
+    // The frame's headers cost more than a couple of small transactions, so only batch when it's smaller on the wire
+    if (batched_bytes >= unbatched_bytes) {
+        return batch_send_unbatched();
+    }
+
+    frame.sequence = ++sequence;
+    frame.checksum = crc8(&frame.sequence, frame.length + 2);
+
+    split_batch_s2m_t response;
+    bool              okay = transport_execute_transaction(batch_frame_ids[frame_index], &frame, trans->initiator2target_buffer_size, &response, sizeof(response));
+    if (okay && response.sequence == frame.sequence) {
+        // The slave has applied the frame, so it becomes the baseline for the next deltas
+        batch_acknowledge(encoded);
+        return true;
+    }
+
+    // The slave may have applied the frame even though the response was lost, so the next attempt must not be a delta
+    batch_acked_valid &= ~encoded;
+    return false;
+}
+
+static void batch_handlers_slave(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_batch_m2s_t *frame    = &split_shmem->batch_m2s;
+    split_batch_s2m_t       *response = &split_shmem->batch_s2m;
+
+    // Only the part of the frame held by this transaction's size was received
+    if (offsetof(split_batch_m2s_t, data) + frame->length <= initiator2target_buffer_size && crc8(&frame->sequence, frame->length + 2) == frame->checksum) {
+        // Apply each record to the shared memory, where the usual slave handlers pick it up
+        uint8_t pos = 0;
+        while (pos + SPLIT_BATCH_RECORD_HEADER_SIZE <= frame->length) {
+            int8_t  id    = frame->data[pos];
+            uint8_t start = frame->data[pos + 1];
+            uint8_t len   = frame->data[pos + 2];
+            pos += SPLIT_BATCH_RECORD_HEADER_SIZE;
+            if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS || pos + len > frame->length || start + len > split_transaction_table[id].initiator2target_buffer_size) {
+                break;
+            }
+            memcpy(split_trans_initiator2target_buffer(&split_transaction_table[id]) + start, &frame->data[pos], len);
+            pos += len;
+        }
+        response->sequence = frame->sequence;
+    }
+}
+
+// A frame transaction carrying the first data_size bytes of the frame's data
+#    define trans_batch_frame_initializer(data_size) \
+        { offsetof(split_batch_m2s_t, data) + (data_size), offsetof(split_shared_memory_t, batch_m2s), sizeof_member(split_shared_memory_t, batch_s2m), offsetof(split_shared_memory_t, batch_s2m), batch_handlers_slave }
+
+#    define TRANSACTIONS_BATCH_MASTER() TRANSACTION_HANDLER_MASTER(batch)
+#    define TRANSACTIONS_BATCH_REGISTRATIONS                                                              \
+        [EXCHANGE_BATCH_QUARTER] = trans_batch_frame_initializer((SPLIT_TRANSACTION_BATCH_SIZE) / 4), \
+        [EXCHANGE_BATCH_HALF]    = trans_batch_frame_initializer((SPLIT_TRANSACTION_BATCH_SIZE) / 2), \
+        [EXCHANGE_BATCH]         = trans_batch_frame_initializer(SPLIT_TRANSACTION_BATCH_SIZE),
+
+#else // SPLIT_TRANSACTION_BATCHING
+
+#    define TRANSACTIONS_BATCH_MASTER()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // SPLIT_TRANSACTION_BATCHING
+
 ////////////////////////////////////////////////////
 // Master matrix
 
@@ -926,6 +1164,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 
     // clang-format off
     TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
+    TRANSACTIONS_BATCH_REGISTRATIONS
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
     TRANSACTIONS_ENCODERS_REGISTRATIONS
     TRANSACTIONS_SYNC_TIMER_REGISTRATIONS
@@ -974,6 +1213,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_BATCH_MASTER();
     return true;
 }
 
@@ -57,6 +57,26 @@ typedef struct _split_slave_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
 } split_slave_matrix_sync_t;
 
+#ifdef SPLIT_TRANSACTION_BATCHING
+#    ifndef SPLIT_TRANSACTION_BATCH_SIZE
+#        define SPLIT_TRANSACTION_BATCH_SIZE 32
+#    endif // SPLIT_TRANSACTION_BATCH_SIZE
+
+// Each record is the transaction ID, the offset into its data, and the length, followed by that many bytes
+#    define SPLIT_BATCH_RECORD_HEADER_SIZE 3
+
+typedef struct _split_batch_m2s_t {
+    uint8_t checksum; // crc8 of sequence, length and the used part of data
+    uint8_t sequence;
+    uint8_t length;
+    uint8_t data[SPLIT_TRANSACTION_BATCH_SIZE];
+} split_batch_m2s_t;
+
+typedef struct _split_batch_s2m_t {
+    uint8_t sequence; // sequence of the last frame applied by the slave
+} split_batch_s2m_t;
+#endif // SPLIT_TRANSACTION_BATCHING
+
 #ifdef SPLIT_TRANSPORT_MIRROR
 typedef struct _split_master_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
@@ -154,6 +174,11 @@ typedef struct _split_shared_memory_t {
 
     split_slave_matrix_sync_t smatrix;
 
+#ifdef SPLIT_TRANSACTION_BATCHING
+    split_batch_m2s_t batch_m2s;
+    split_batch_s2m_t batch_s2m;
+#endif // SPLIT_TRANSACTION_BATCHING
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     split_master_matrix_sync_t mmatrix;
 #endif // SPLIT_TRANSPORT_MIRROR
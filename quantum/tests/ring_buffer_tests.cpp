@@ -0,0 +1,204 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <thread>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "ring_buffer.h"
+}
+
+RING_BUFFER_DEFINE(byte_ring, uint8_t, 8)
+RING_BUFFER_DEFINE(single_ring, uint16_t, 1)
+RING_BUFFER_DEFINE(word_ring, uint32_t, 128)
+RING_BUFFER_DEFINE(odd_ring, uint8_t, 5)
+RING_BUFFER_DEFINE(large_ring, uint8_t, 255)
+
+class RingBuffer : public ::testing::Test {};
+
+TEST_F(RingBuffer, PushAndPopInOrder) {
+    byte_ring_t ring = {};
+    uint8_t     value;
+
+    EXPECT_TRUE(byte_ring_is_empty(&ring));
+    EXPECT_FALSE(byte_ring_pop(&ring, &value));
+
+    EXPECT_TRUE(byte_ring_push(&ring, 1));
+    EXPECT_TRUE(byte_ring_push(&ring, 2));
+    EXPECT_EQ(byte_ring_count(&ring), 2);
+
+    EXPECT_TRUE(byte_ring_pop(&ring, &value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(byte_ring_pop(&ring, &value));
+    EXPECT_EQ(value, 2);
+    EXPECT_TRUE(byte_ring_is_empty(&ring));
+}
+
+TEST_F(RingBuffer, EverySlotIsUsable) {
+    byte_ring_t ring = {};
+
+    for (uint8_t i = 0; i < 8; ++i) {
+        EXPECT_TRUE(byte_ring_push(&ring, i));
+    }
+    EXPECT_EQ(byte_ring_space(&ring), 0);
+    EXPECT_FALSE(byte_ring_push(&ring, 8)) << "Pushed into a full ring";
+
+    uint8_t value;
+    EXPECT_TRUE(byte_ring_pop(&ring, &value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(byte_ring_push(&ring, 8));
+}
+
+TEST_F(RingBuffer, SingleElementRing) {
+    single_ring_t ring = {};
+    uint16_t      value;
+
+    EXPECT_TRUE(single_ring_push(&ring, 0x1234));
+    EXPECT_FALSE(single_ring_push(&ring, 0x5678));
+    EXPECT_TRUE(single_ring_peek(&ring, &value));
+    EXPECT_EQ(value, 0x1234);
+    EXPECT_TRUE(single_ring_pop(&ring, &value));
+    EXPECT_EQ(value, 0x1234);
+    EXPECT_TRUE(single_ring_is_empty(&ring));
+}
+
+TEST_F(RingBuffer, IndicesWrapAround) {
+    byte_ring_t ring = {};
+
+    // Enough to wrap the indices several times, at varying fill levels
+    uint8_t next_in = 0, next_out = 0;
+    for (int i = 0; i < 2000; ++i) {
+        for (int j = 0; j < i % 5 + 1; ++j) {
+            if (byte_ring_push(&ring, next_in)) {
+                next_in++;
+            }
+        }
+        uint8_t value;
+        for (int j = 0; j < i % 4 + 1 && byte_ring_pop(&ring, &value); ++j) {
+            ASSERT_EQ(value, next_out++);
+        }
+        ASSERT_EQ(byte_ring_count(&ring), (uint8_t)(next_in - next_out));
+    }
+}
+
+TEST_F(RingBuffer, SizeNeedNotBeAPowerOfTwo) {
+    odd_ring_t ring = {};
+
+    uint8_t next_in = 0, next_out = 0;
+    for (int i = 0; i < 500; ++i) {
+        for (int j = 0; j < i % 4 + 1; ++j) {
+            if (odd_ring_push(&ring, next_in)) {
+                next_in++;
+            }
+        }
+        ASSERT_EQ(odd_ring_count(&ring) + odd_ring_space(&ring), 5);
+        uint8_t value;
+        for (int j = 0; j < i % 3 + 1 && odd_ring_pop(&ring, &value); ++j) {
+            ASSERT_EQ(value, next_out++);
+        }
+        ASSERT_EQ(odd_ring_count(&ring), (uint8_t)(next_in - next_out));
+    }
+}
+
+TEST_F(RingBuffer, LargestRing) {
+    large_ring_t ring = {};
+    uint8_t      in[255], out[255];
+    for (int i = 0; i < 255; ++i) {
+        in[i] = i;
+    }
+
+    // Fill and drain it a few times from different starting points
+    for (int offset = 0; offset < 3; ++offset) {
+        EXPECT_EQ(large_ring_push_many(&ring, in, 100), 100);
+        EXPECT_EQ(large_ring_skip(&ring, 100), 100);
+
+        EXPECT_EQ(large_ring_push_many(&ring, in, 255), 255);
+        EXPECT_EQ(large_ring_space(&ring), 0);
+        EXPECT_FALSE(large_ring_push(&ring, 0));
+        EXPECT_EQ(large_ring_count(&ring), 255);
+        EXPECT_EQ(large_ring_pop_many(&ring, out, 255), 255);
+        EXPECT_EQ(memcmp(in, out, 255), 0);
+        EXPECT_TRUE(large_ring_is_empty(&ring));
+    }
+}
+
+TEST_F(RingBuffer, BatchOperations) {
+    byte_ring_t ring = {};
+
+    // Pushing more than fits pushes what it can
+    uint8_t in[10] = {10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+    EXPECT_EQ(byte_ring_push_many(&ring, in, 5), 5);
+    EXPECT_EQ(byte_ring_push_many(&ring, in + 5, 5), 3);
+    EXPECT_EQ(byte_ring_count(&ring), 8);
+
+    // Peeking leaves everything in place
+    uint8_t out[10] = {0};
+    EXPECT_EQ(byte_ring_peek_many(&ring, out, 3), 3);
+    EXPECT_EQ(out[0], 10);
+    EXPECT_EQ(out[2], 12);
+    EXPECT_EQ(byte_ring_count(&ring), 8);
+
+    EXPECT_EQ(byte_ring_skip(&ring, 2), 2);
+    EXPECT_EQ(byte_ring_pop_many(&ring, out, 10), 6);
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_EQ(out[i], 12 + i);
+    }
+    EXPECT_EQ(byte_ring_skip(&ring, 1), 0);
+
+    // Batches are split across the end of the storage
+    EXPECT_EQ(byte_ring_push_many(&ring, in, 7), 7);
+    EXPECT_EQ(byte_ring_pop_many(&ring, out, 7), 7);
+    EXPECT_EQ(memcmp(in, out, 7), 0);
+}
+
+TEST_F(RingBuffer, Clear) {
+    byte_ring_t ring = {};
+
+    byte_ring_push(&ring, 1);
+    byte_ring_push(&ring, 2);
+    byte_ring_clear(&ring);
+    EXPECT_TRUE(byte_ring_is_empty(&ring));
+    EXPECT_EQ(byte_ring_space(&ring), 8);
+}
+
+TEST_F(RingBuffer, ConcurrentProducerAndConsumer) {
+    static word_ring_t ring  = {};
+    const uint32_t     total = 200000;
+    std::atomic<bool>  failed{false};
+
+    std::thread producer([&] {
+        uint32_t next = 0;
+        uint32_t batch[5];
+        while (next < total) {
+            uint8_t count = 0;
+            while (count < 5 && next + count < total) {
+                batch[count] = next + count;
+                count++;
+            }
+            uint8_t pushed = word_ring_push_many(&ring, batch, count);
+            if (pushed == 0) {
+                std::this_thread::yield();
+            }
+            next += pushed;
+        }
+    });
+
+    uint32_t expected = 0;
+    uint32_t batch[7];
+    while (expected < total && !failed) {
+        uint8_t count = word_ring_pop_many(&ring, batch, 7);
+        if (count == 0) {
+            std::this_thread::yield();
+        }
+        for (uint8_t i = 0; i < count; ++i) {
+            if (batch[i] != expected++) {
+                failed = true;
+            }
+        }
+    }
+    producer.join();
+
+    EXPECT_FALSE(failed) << "Elements were lost, duplicated or reordered";
+    EXPECT_TRUE(word_ring_is_empty(&ring));
+}
@@ -0,0 +1,2 @@
+ring_buffer_SRC := \
+	$(QUANTUM_PATH)/tests/ring_buffer_tests.cpp
@@ -0,0 +1,2 @@
+TEST_LIST += \
+	ring_buffer
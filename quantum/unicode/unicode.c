@@ -216,98 +216,98 @@ __attribute__((weak)) void unicode_input_start(void) {
     // UNICODE_KEY_LNX (which is usually Ctrl-Shift-U) might not work
     // correctly in the shifted case.
     if (unicode_config.input_mode == UNICODE_MODE_LINUX && unicode_saved_led_state.caps_lock) {
-        tap_code(KC_CAPS_LOCK);
+        send_string_tap_code(KC_CAPS_LOCK);
     }
 
     unicode_saved_mods = get_mods(); // Save current mods
-    clear_mods();                    // Unregister mods to start from a clean state
-    clear_weak_mods();
+    send_string_set_mods(0);         // Unregister mods to start from a clean state
+    send_string_clear_weak_mods();
 
     switch (unicode_config.input_mode) {
         case UNICODE_MODE_MACOS:
-            register_code(UNICODE_KEY_MAC);
+            send_string_register_code(UNICODE_KEY_MAC);
             break;
         case UNICODE_MODE_LINUX:
-            tap_code16(UNICODE_KEY_LNX);
+            send_string_tap_code(UNICODE_KEY_LNX);
             break;
         case UNICODE_MODE_WINDOWS:
             // For increased reliability, use numpad keys for inputting digits
             if (!unicode_saved_led_state.num_lock) {
-                tap_code(KC_NUM_LOCK);
+                send_string_tap_code(KC_NUM_LOCK);
             }
-            register_code(KC_LEFT_ALT);
-            wait_ms(UNICODE_TYPE_DELAY);
-            tap_code(KC_KP_PLUS);
+            send_string_register_code(KC_LEFT_ALT);
+            send_string_wait(UNICODE_TYPE_DELAY);
+            send_string_tap_code(KC_KP_PLUS);
             break;
         case UNICODE_MODE_WINCOMPOSE:
-            tap_code(UNICODE_KEY_WINC);
-            tap_code(KC_U);
+            send_string_tap_code(UNICODE_KEY_WINC);
+            send_string_tap_code(KC_U);
             break;
         case UNICODE_MODE_EMACS:
             // The usual way to type unicode in emacs is C-x-8 <RET> then the unicode number in hex
-            tap_code16(LCTL(KC_X));
-            tap_code16(KC_8);
-            tap_code16(KC_ENTER);
+            send_string_tap_code(LCTL(KC_X));
+            send_string_tap_code(KC_8);
+            send_string_tap_code(KC_ENTER);
             break;
     }
 
-    wait_ms(UNICODE_TYPE_DELAY);
+    send_string_wait(UNICODE_TYPE_DELAY);
 }
 
 __attribute__((weak)) void unicode_input_finish(void) {
     switch (unicode_config.input_mode) {
         case UNICODE_MODE_MACOS:
-            unregister_code(UNICODE_KEY_MAC);
+            send_string_unregister_code(UNICODE_KEY_MAC);
             break;
         case UNICODE_MODE_LINUX:
-            tap_code(KC_SPACE);
+            send_string_tap_code(KC_SPACE);
             if (unicode_saved_led_state.caps_lock) {
-                tap_code(KC_CAPS_LOCK);
+                send_string_tap_code(KC_CAPS_LOCK);
             }
             break;
         case UNICODE_MODE_WINDOWS:
-            unregister_code(KC_LEFT_ALT);
+            send_string_unregister_code(KC_LEFT_ALT);
             if (!unicode_saved_led_state.num_lock) {
-                tap_code(KC_NUM_LOCK);
+                send_string_tap_code(KC_NUM_LOCK);
             }
             break;
         case UNICODE_MODE_WINCOMPOSE:
-            tap_code(KC_ENTER);
+            send_string_tap_code(KC_ENTER);
             break;
         case UNICODE_MODE_EMACS:
-            tap_code16(KC_ENTER);
+            send_string_tap_code(KC_ENTER);
             break;
     }
 
-    set_mods(unicode_saved_mods); // Reregister previously set mods
+    send_string_set_mods(unicode_saved_mods); // Reregister previously set mods
 }
 
 __attribute__((weak)) void unicode_input_cancel(void) {
     switch (unicode_config.input_mode) {
         case UNICODE_MODE_MACOS:
-            unregister_code(UNICODE_KEY_MAC);
+            send_string_unregister_code(UNICODE_KEY_MAC);
             break;
         case UNICODE_MODE_LINUX:
-            tap_code(KC_ESCAPE);
+            send_string_tap_code(KC_ESCAPE);
             if (unicode_saved_led_state.caps_lock) {
-                tap_code(KC_CAPS_LOCK);
+                send_string_tap_code(KC_CAPS_LOCK);
             }
             break;
         case UNICODE_MODE_WINCOMPOSE:
-            tap_code(KC_ESCAPE);
+            send_string_tap_code(KC_ESCAPE);
             break;
         case UNICODE_MODE_WINDOWS:
-            unregister_code(KC_LEFT_ALT);
+            send_string_unregister_code(KC_LEFT_ALT);
             if (!unicode_saved_led_state.num_lock) {
-                tap_code(KC_NUM_LOCK);
+                send_string_tap_code(KC_NUM_LOCK);
             }
             break;
         case UNICODE_MODE_EMACS:
-            tap_code16(LCTL(KC_G)); // C-g cancels
+            send_string_tap_code(LCTL(KC_G)); // C-g cancels
             break;
     }
 
-    set_mods(unicode_saved_mods); // Reregister previously set mods
+    send_string_set_mods(unicode_saved_mods); // Reregister previously set mods
 }
 
 // clang-format off
@@ -317,7 +317,7 @@ static void send_nibble_wrapper(uint8_t digit) {
         uint8_t kc = digit < 10
                    ? KC_KP_1 + (10 + digit - 1) % 10
                    : KC_A + (digit - 10);
-        tap_code(kc);
+        send_string_tap_code(kc);
         return;
     }
     send_nibble(digit);
@@ -390,3 +390,11 @@ void send_unicode_string(const char *str) {
         }
     }
 }
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+bool send_unicode_string_async(const char *str, send_string_async_callback_t callback, void *context) {
+    send_string_async_begin();
+    send_unicode_string(str);
+    return send_string_async_end(callback, context);
+}
+#endif
@@ -19,6 +19,10 @@
 #include <stdint.h>
 #include "unicode_keycodes.h"
 
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include "send_string.h"
+#endif
+
 /**
  * \file
  *
@@ -131,4 +135,19 @@ void register_unicode(uint32_t code_point);
  */
 void send_unicode_string(const char *str);
 
+#if defined(SEND_STRING_ASYNC_ENABLE) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a string containing Unicode characters to be sent from the main loop.
+ *
+ * The current modifiers and lock states are captured when the string is queued.
+ *
+ * \param str The string to send.
+ * \param callback An optional function to call once the whole string has been sent.
+ * \param context Passed to `callback`.
+ *
+ * \return false if the string does not fit in the queue, in which case nothing is queued
+ */
+bool send_unicode_string_async(const char *str, send_string_async_callback_t callback, void *context);
+#endif
+
 /** \} */
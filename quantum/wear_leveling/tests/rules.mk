@@ -63,4 +63,30 @@ wear_leveling_8byte_SRC := \
 	$(wear_leveling_common_SRC) \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
-	$(wear_leveling_common_INC)
\ No newline at end of file
+	$(wear_leveling_common_INC)
+
+wear_leveling_batch_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=2048 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=1024 \
+	-DWEAR_LEVELING_PENDING_RANGES=4
+wear_leveling_batch_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_batch.cpp
+wear_leveling_batch_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_write_back_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=2048 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=1024 \
+	-DWEAR_LEVELING_PENDING_RANGES=4 \
+	-DWEAR_LEVELING_WRITE_BACK_DELAY=500
+wear_leveling_write_back_SRC := \
+	$(wear_leveling_common_SRC) \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_batch.cpp
+wear_leveling_write_back_INC := \
+	$(wear_leveling_common_INC)
@@ -0,0 +1,270 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+#ifdef WEAR_LEVELING_WRITE_BACK_DELAY
+extern "C" {
+#    include "timer.h"
+void advance_time(uint32_t ms);
+}
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY
+
+class WearLevelingBatch : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    wear_leveling_status_t test_write_byte(const uint32_t address, uint8_t value) {
+        return test_write(address, &value, 1);
+    }
+
+    // Re-initialises from the backing store, and checks that the write log plays back to the expected data
+    void verify_playback() {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+        EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        EXPECT_EQ(readback, verify_data) << "Invalid readback";
+    }
+};
+
+/**
+ * This test verifies that writes during a batch only reach the backing store once the batch ends, but are readable straight away.
+ */
+TEST_F(WearLevelingBatch, WritesDeferredUntilBatchEnd) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint64_t write_count = inst.write_invoke_count();
+    wear_leveling_batch_begin();
+    EXPECT_EQ(test_write_byte(200, 0x42), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(test_write_byte(400, 0x43), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Backing store was written during the batch";
+
+    uint8_t value = 0;
+    EXPECT_EQ(wear_leveling_read(400, &value, 1), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(value, 0x43) << "Cache was not updated during the batch";
+
+#ifndef WEAR_LEVELING_WRITE_BACK_DELAY
+    EXPECT_EQ(wear_leveling_batch_end(), WEAR_LEVELING_SUCCESS) << "Batch end returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), write_count + 4) << "Expected two single byte multibyte entries";
+#else
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    wear_leveling_batch_end();
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY
+
+    verify_playback();
+}
+
+/**
+ * This test verifies that nested batches only flush when the outermost batch ends.
+ */
+TEST_F(WearLevelingBatch, NestedBatches) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint64_t write_count = inst.write_invoke_count();
+    wear_leveling_batch_begin();
+    wear_leveling_batch_begin();
+    test_write_byte(300, 0x55);
+    EXPECT_EQ(wear_leveling_batch_end(), WEAR_LEVELING_SUCCESS) << "Batch end returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Inner batch end flushed the pending data";
+    wear_leveling_batch_end();
+    wear_leveling_flush();
+    EXPECT_GT(inst.write_invoke_count(), write_count) << "Outer batch end did not flush the pending data";
+
+    verify_playback();
+}
+
+/**
+ * This test verifies that adjacent byte-by-byte writes are coalesced into full multibyte log entries.
+ */
+TEST_F(WearLevelingBatch, AdjacentWritesCoalesced) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint64_t write_count = inst.write_invoke_count();
+    wear_leveling_batch_begin();
+    for (uint32_t address = 500; address < 510; ++address) {
+        test_write_byte(address, 0x20 + address);
+    }
+    wear_leveling_batch_end();
+    wear_leveling_flush();
+
+    // Two 5-byte multibyte entries, of 4 backing writes each
+    EXPECT_EQ(inst.write_invoke_count(), write_count + 8) << "Writes were not coalesced";
+
+    verify_playback();
+}
+
+/**
+ * This test verifies that overlapping writes log the latest values, and that unchanged bytes are not logged.
+ */
+TEST_F(WearLevelingBatch, OverlappingWritesLogLatestValues) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, 5> first  = {0x31, 0x32, 0x33, 0x34, 0x35};
+    std::array<std::uint8_t, 5> second = {0x41, 0x42, 0x43, 0x44, 0x45};
+    std::array<std::uint8_t, 5> third  = {0x41, 0x42, 0x99, 0x44, 0x45};
+
+    uint64_t write_count = inst.write_invoke_count();
+    wear_leveling_batch_begin();
+    test_write(100, first.data(), first.size());
+    test_write(102, second.data(), second.size());
+    test_write(102, third.data(), third.size());
+    wear_leveling_batch_end();
+    wear_leveling_flush();
+
+    // A single 7-byte range, as one 5-byte and one 2-byte multibyte entry
+    EXPECT_EQ(inst.write_invoke_count(), write_count + 4 + 3) << "Overlapping writes were not merged";
+
+    verify_playback();
+
+    // Only the changed byte of an otherwise identical write should be logged
+    write_count = inst.write_invoke_count();
+    third[4]    = 0x77;
+    wear_leveling_batch_begin();
+    test_write(102, third.data(), third.size());
+    wear_leveling_batch_end();
+    wear_leveling_flush();
+    EXPECT_EQ(inst.write_invoke_count(), write_count + 2) << "Unchanged bytes were logged";
+
+    verify_playback();
+}
+
+/**
+ * This test verifies that running out of pending ranges merges the closest ones, without losing data.
+ */
+TEST_F(WearLevelingBatch, PendingRangeOverflow) {
+    wear_leveling_batch_begin();
+    for (int i = 0; i < WEAR_LEVELING_PENDING_RANGES * 3; ++i) {
+        // Uneven gaps, so that different ranges are the closest as more are added
+        test_write_byte(64 + i * (i % 3 + 4), 0x80 + i);
+    }
+    wear_leveling_batch_end();
+    wear_leveling_flush();
+
+    verify_playback();
+}
+
+/**
+ * This test verifies that a batch too large for the remaining write log consolidates once, without filling the log first.
+ */
+TEST_F(WearLevelingBatch, LargeBatchConsolidatesOnce) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint64_t erase_count = inst.erase_invoke_count();
+    uint64_t write_count = inst.write_invoke_count();
+    wear_leveling_batch_begin();
+    for (uint32_t address = 0; address < WEAR_LEVELING_LOGICAL_SIZE; ++address) {
+        test_write_byte(address, 0x20 + (address % 0xC0));
+    }
+#ifndef WEAR_LEVELING_WRITE_BACK_DELAY
+    EXPECT_EQ(wear_leveling_batch_end(), WEAR_LEVELING_CONSOLIDATED) << "Batch end returned incorrect status";
+#else
+    wear_leveling_batch_end();
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_CONSOLIDATED) << "Flush returned incorrect status";
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY
+
+    EXPECT_EQ(inst.erase_invoke_count(), erase_count + 1) << "Expected a single consolidation";
+    EXPECT_EQ(inst.write_invoke_count(), write_count + (WEAR_LEVELING_LOGICAL_SIZE + 8) / BACKING_STORE_WRITE_SIZE) << "Expected only the consolidated data and checksum to be written";
+
+    verify_playback();
+}
+
+/**
+ * This test compares the backing store activity of a keymap-sized byte-by-byte upload with and without a batch.
+ */
+TEST_F(WearLevelingBatch, BulkUploadErasures) {
+    auto& inst = MockBackingStore::Instance();
+
+    auto upload = [&](uint8_t seed) {
+        for (uint32_t address = 64; address < 64 + 512; ++address) {
+            test_write_byte(address, seed + (address % 0xC0));
+        }
+    };
+
+#ifndef WEAR_LEVELING_WRITE_BACK_DELAY
+    for (int i = 0; i < 4; ++i) {
+        upload(0x20 + i);
+    }
+    uint64_t unbatched_erases = inst.erase_invoke_count();
+    uint64_t unbatched_writes = inst.write_invoke_count();
+    verify_playback();
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY
+
+    inst.reset_instance();
+    wear_leveling_init();
+    std::fill(verify_data.begin(), verify_data.end(), 0);
+
+    for (int i = 0; i < 4; ++i) {
+        wear_leveling_batch_begin();
+        upload(0x20 + i);
+        wear_leveling_batch_end();
+        wear_leveling_flush();
+    }
+    uint64_t batched_erases = inst.erase_invoke_count();
+    uint64_t batched_writes = inst.write_invoke_count();
+    verify_playback();
+
+    RecordProperty("batched_erases", std::to_string(batched_erases));
+    RecordProperty("batched_writes", std::to_string(batched_writes));
+#ifndef WEAR_LEVELING_WRITE_BACK_DELAY
+    RecordProperty("unbatched_erases", std::to_string(unbatched_erases));
+    RecordProperty("unbatched_writes", std::to_string(unbatched_writes));
+    EXPECT_LT(batched_erases, unbatched_erases) << "Batching did not reduce erasures";
+    EXPECT_LT(batched_writes, unbatched_writes) << "Batching did not reduce backing store writes";
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY
+}
+
+#ifdef WEAR_LEVELING_WRITE_BACK_DELAY
+/**
+ * This test verifies that pending writes are flushed once no writes have occurred for the write-back delay.
+ */
+TEST_F(WearLevelingBatch, WriteBackAfterDelay) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint64_t write_count = inst.write_invoke_count();
+    test_write_byte(200, 0x42);
+    advance_time(WEAR_LEVELING_WRITE_BACK_DELAY - 1);
+    test_write_byte(201, 0x43);
+    advance_time(WEAR_LEVELING_WRITE_BACK_DELAY - 1);
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Pending data was flushed before the delay elapsed";
+
+    advance_time(1);
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), write_count + 3) << "Expected a single 2-byte multibyte entry";
+
+    verify_playback();
+}
+
+/**
+ * This test verifies that an open batch holds back the write-back flush.
+ */
+TEST_F(WearLevelingBatch, WriteBackWaitsForBatch) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint64_t write_count = inst.write_invoke_count();
+    wear_leveling_batch_begin();
+    test_write_byte(200, 0x42);
+    advance_time(WEAR_LEVELING_WRITE_BACK_DELAY * 2);
+    wear_leveling_task();
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Pending data was flushed during a batch";
+
+    wear_leveling_batch_end();
+    wear_leveling_task();
+    EXPECT_GT(inst.write_invoke_count(), write_count) << "Pending data was not flushed after the batch";
+
+    verify_playback();
+}
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY
@@ -4,6 +4,9 @@
 #include "fnv.h"
 #include "wear_leveling.h"
 #include "wear_leveling_internal.h"
+#ifdef WEAR_LEVELING_WRITE_BACK_DELAY
+#    include "timer.h"
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY
 
 /*
     This wear leveling algorithm is adapted from algorithms from previous
@@ -76,6 +79,14 @@
             * A new write log entry is appended to the log.
             * If the log's full, data is consolidated and the write log cleared.
 
+        During batches, or with a write-back delay:
+            * The cache is updated with the new data.
+            * The range of changed bytes is recorded, merged with any
+                overlapping or adjacent ranges already pending.
+            * When the batch ends or the delay elapses, each pending range is
+                appended to the log -- or if they wouldn't fit, data is
+                consolidated directly.
+
     Write log structure:
 
         The first 8 bytes of the write log are a FNV1a_64 hash of the contents
@@ -164,6 +175,27 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     bool                                                           unlocked;
 } wear_leveling;
 
+/**
+ * A range of logical data updated in the cache but not yet appended to the write log, end exclusive.
+ */
+typedef struct wear_leveling_pending_range_t {
+    uint32_t start;
+    uint32_t end;
+} wear_leveling_pending_range_t;
+
+/**
+ * Pending writes, held back while a batch is open or until the write-back delay has elapsed.
+ * Ranges are kept in address order, and never overlap or touch each other.
+ */
+static struct {
+    wear_leveling_pending_range_t ranges[(WEAR_LEVELING_PENDING_RANGES) + 1]; // +1 for the range being added
+    uint8_t                       count;
+    uint8_t                       batch_depth;
+#ifdef WEAR_LEVELING_WRITE_BACK_DELAY
+    uint32_t last_write;
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY
+} wear_leveling_pending;
+
 /**
  * Locking helper: status
  */
@@ -205,6 +237,63 @@ static void wear_leveling_clear_cache(void) {
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
 }
 
+/**
+ * Whether writes should only update the cache and be appended to the write log later.
+ */
+static inline bool wear_leveling_defer_writes(void) {
+#ifdef WEAR_LEVELING_WRITE_BACK_DELAY
+    return true;
+#else
+    return wear_leveling_pending.batch_depth > 0;
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY
+}
+
+/**
+ * Records a range of the cache as pending, merging it with any overlapping or adjacent ranges.
+ */
+static void wear_leveling_pending_add(uint32_t start, uint32_t end) {
+    wear_leveling_pending_range_t *ranges = wear_leveling_pending.ranges;
+    uint8_t                        count  = wear_leveling_pending.count;
+
+    // Insert the new range in address order
+    uint8_t i = count++;
+    while (i > 0 && ranges[i - 1].start > start) {
+        ranges[i] = ranges[i - 1];
+        --i;
+    }
+    ranges[i] = (wear_leveling_pending_range_t){.start = start, .end = end};
+
+    // Coalesce overlapping and adjacent ranges
+    uint8_t last = 0;
+    for (i = 1; i < count; ++i) {
+        if (ranges[i].start <= ranges[last].end) {
+            if (ranges[i].end > ranges[last].end) {
+                ranges[last].end = ranges[i].end;
+            }
+        } else {
+            ranges[++last] = ranges[i];
+        }
+    }
+    count = last + 1;
+
+    // If we've run out of ranges, merge the two closest ones -- the bytes between them are logged with their current values
+    if (count > (WEAR_LEVELING_PENDING_RANGES)) {
+        uint8_t closest = 0;
+        for (i = 1; i + 1 < count; ++i) {
+            if (ranges[i + 1].start - ranges[i].end < ranges[closest + 1].start - ranges[closest].end) {
+                closest = i;
+            }
+        }
+        ranges[closest].end = ranges[closest + 1].end;
+        for (i = closest + 1; i + 1 < count; ++i) {
+            ranges[i] = ranges[i + 1];
+        }
+        --count;
+    }
+
+    wear_leveling_pending.count = count;
+}
+
 /**
  * Reads the consolidated data from the backing store into the cache.
  * Does not consider the write log.
@@ -469,6 +558,35 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+/**
+ * Appends the pending ranges of the cache to the write log, or consolidates if they wouldn't fit.
+ * Pre-condition: the backing store is unlocked.
+ */
+static wear_leveling_status_t wear_leveling_write_pending(void) {
+    // Upper bound of the log space needed -- no encoding takes more than 2 bytes per logical byte, plus a partially-filled entry at the end of each range
+    uint32_t log_size = 0;
+    for (uint8_t i = 0; i < wear_leveling_pending.count; ++i) {
+        log_size += 2 * (wear_leveling_pending.ranges[i].end - wear_leveling_pending.ranges[i].start) + 8;
+    }
+
+    // If the log would fill up part way through, skip straight to consolidating the cache instead
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    if (wear_leveling.write_address + log_size > (WEAR_LEVELING_BACKING_SIZE)) {
+        status = wear_leveling_consolidate_force();
+    } else {
+        for (uint8_t i = 0; i < wear_leveling_pending.count && status == WEAR_LEVELING_SUCCESS; ++i) {
+            const uint32_t start = wear_leveling_pending.ranges[i].start;
+            status               = wear_leveling_write_raw(start, &wear_leveling.cache[start], wear_leveling_pending.ranges[i].end - start);
+        }
+        if (status == WEAR_LEVELING_SUCCESS) {
+            status = wear_leveling_consolidate_if_needed();
+        }
+    }
+
+    wear_leveling_pending.count = 0;
+    return status;
+}
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
@@ -619,6 +737,7 @@ wear_leveling_status_t wear_leveling_init(void) {
 
     // Reset the cache
     wear_leveling_clear_cache();
+    wear_leveling_pending.count = 0;
 
     // Initialise the backing store
     if (!backing_store_init()) {
@@ -662,6 +781,7 @@ wear_leveling_status_t wear_leveling_erase(void) {
     // Perform the erase
     bool ret = backing_store_erase();
     wear_leveling_clear_cache();
+    wear_leveling_pending.count = 0;
 
     // Lock the backing store if we acquired the lock successfully
     if (lock_status == STATUS_SUCCESS) {
@@ -688,6 +808,26 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
         return true;
     }
 
+    if (wear_leveling_defer_writes()) {
+        // Only the changed bytes need to reach the write log
+        const uint8_t *p     = value;
+        size_t         first = 0;
+        size_t         last  = length;
+        while (p[first] == wear_leveling.cache[address + first]) {
+            ++first;
+        }
+        while (p[last - 1] == wear_leveling.cache[address + last - 1]) {
+            --last;
+        }
+
+        memcpy(&wear_leveling.cache[address], value, length);
+        wear_leveling_pending_add(address + first, address + last);
+#ifdef WEAR_LEVELING_WRITE_BACK_DELAY
+        wear_leveling_pending.last_write = timer_read32();
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY
+        return WEAR_LEVELING_SUCCESS;
+    }
+
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
 
@@ -726,6 +866,71 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     return status;
 }
 
+/**
+ * Starts a batch of writes.
+ */
+void wear_leveling_batch_begin(void) {
+    ++wear_leveling_pending.batch_depth;
+}
+
+/**
+ * Ends a batch of writes, flushing the pending data once the outermost batch ends.
+ */
+wear_leveling_status_t wear_leveling_batch_end(void) {
+    wl_assert(wear_leveling_pending.batch_depth > 0);
+    if (wear_leveling_pending.batch_depth == 0 || --wear_leveling_pending.batch_depth > 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+#ifdef WEAR_LEVELING_WRITE_BACK_DELAY
+    // Left to wear_leveling_task()
+    return WEAR_LEVELING_SUCCESS;
+#else
+    return wear_leveling_flush();
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY
+}
+
+/**
+ * Appends any pending data to the write log.
+ */
+wear_leveling_status_t wear_leveling_flush(void) {
+    if (wear_leveling_pending.count == 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wl_dprintf("Flush\n");
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = wear_leveling_write_pending();
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+
+#ifdef WEAR_LEVELING_WRITE_BACK_DELAY
+/**
+ * Flushes pending data once writes have been idle for long enough.
+ */
+wear_leveling_status_t wear_leveling_task(void) {
+    if (wear_leveling_pending.count == 0 || wear_leveling_pending.batch_depth > 0 || timer_elapsed32(wear_leveling_pending.last_write) < (WEAR_LEVELING_WRITE_BACK_DELAY)) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    return wear_leveling_flush();
+}
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY
+
 /**
  * Reads logical data from the cache.
  */
@@ -36,6 +36,9 @@ wear_leveling_status_t wear_leveling_erase(void);
  * determine if an overwrite should occur -- if there is any data mismatch the entire block will be written to the log,
  * not just the changed bytes.
  *
+ * While a batch is open, or if WEAR_LEVELING_WRITE_BACK_DELAY is defined, only the cache is updated and the changed bytes
+ * are appended to the write log by a later flush.
+ *
  * @param address[in] the logical address to write data
  * @param value[in] pointer to the source buffer
  * @param length[in] length of the data
@@ -52,3 +55,39 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Starts a batch of writes.
+ *
+ * Until the matching wear_leveling_batch_end(), writes only update the cache and record the changed range. Overlapping
+ * and adjacent ranges are merged, so the write log receives a single set of entries for the whole batch. Batches may be
+ * nested.
+ */
+void wear_leveling_batch_begin(void);
+
+/**
+ * Ends a batch of writes, flushing the pending data when the outermost batch ends.
+ *
+ * With WEAR_LEVELING_WRITE_BACK_DELAY, the flush is instead left to wear_leveling_task().
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_batch_end(void);
+
+/**
+ * Appends any pending data to the write log.
+ *
+ * If the pending data would not fit in the remaining write log, the cache is consolidated instead.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_flush(void);
+
+#ifdef WEAR_LEVELING_WRITE_BACK_DELAY
+/**
+ * Flushes pending data once no writes have occurred for WEAR_LEVELING_WRITE_BACK_DELAY milliseconds.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_task(void);
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY
@@ -0,0 +1,160 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+void set_time(uint32_t t);
+
+extern uint8_t  note_timbre;
+extern bool     vibrato;
+extern uint16_t voices_timer;
+}
+
+namespace {
+
+// the float math voices.c used before moving to fixed-point, as the reference
+float reference_vibrato(float frequency, uint16_t time) {
+    float counter = fmodf(time / (100 * 0.125f), VIBRATO_LUT_LENGTH);
+    return frequency * powf(vibrato_lut[(int)counter], 0.5f);
+}
+
+float reference_delayed_vibrato(float frequency, uint16_t compensated_index) {
+    return frequency * vibrato_lut[(int)fmodf((((float)compensated_index - 151) / 1000 * 50), VIBRATO_LUT_LENGTH)];
+}
+
+uint8_t reference_butts_fader_timbre(uint16_t compensated_index) {
+    return 12 - (uint8_t)(powf(((float)compensated_index - 20) / (200 - 20), 2) * 12.5);
+}
+
+uint8_t reference_duty_octave_down_timbre(uint16_t envelope_index) {
+    uint8_t timbre = (uint8_t)(100 * (envelope_index % 2) * .125 + .375 * 2);
+    if ((envelope_index % 4) == 0) timbre = 50;
+    if ((envelope_index % 8) == 0) timbre = 0;
+    return timbre;
+}
+
+const float all_notes[] = {
+    NOTE_C0, NOTE_CS0, NOTE_D0, NOTE_DS0, NOTE_E0, NOTE_F0, NOTE_FS0, NOTE_G0, NOTE_GS0, NOTE_A0, NOTE_AS0, NOTE_B0, //
+    NOTE_C4, NOTE_CS4, NOTE_D4, NOTE_DS4, NOTE_E4, NOTE_F4, NOTE_FS4, NOTE_G4, NOTE_GS4, NOTE_A4, NOTE_AS4, NOTE_B4, //
+    NOTE_C8, NOTE_CS8, NOTE_D8, NOTE_DS8, NOTE_E8, NOTE_F8, NOTE_FS8, NOTE_G8, NOTE_GS8, NOTE_A8, NOTE_AS8, NOTE_B8,
+};
+
+class AudioFixedPointTest : public TestFixture {
+   public:
+    void SetUp() override {
+        audio_on();
+        audio_stop_all();
+        audio_set_tempo(TEMPO_DEFAULT);
+        set_voice(default_voice);
+        set_time(0);
+    }
+
+    void TearDown() override {
+        audio_stop_all();
+        set_voice(default_voice);
+        vibrato = false;
+    }
+};
+
+TEST_F(AudioFixedPointTest, FrequencyMatchesFloatPitch) {
+    for (float note : all_notes) {
+        audio_play_tone(note);
+        ASSERT_EQ(audio_get_number_of_active_tones(), 1);
+        EXPECT_EQ(audio_get_processed_frequency_fixed(0), (audio_freq_t)lroundf(note * 65536)) << note;
+        EXPECT_NEAR(audio_get_processed_frequency(0), note, 1.0f / 65536) << note;
+        EXPECT_NEAR(audio_get_frequency(0), note, 1.0f / 65536) << note;
+
+        audio_stop_tone(note);
+        EXPECT_EQ(audio_get_number_of_active_tones(), 0);
+    }
+}
+
+TEST_F(AudioFixedPointTest, MelodyTiming) {
+    float         melody[][2] = SONG(Q__NOTE(_C4), E__NOTE(_E4), E__NOTE(_E4), S__NOTE(_G4), QD_NOTE(_REST), H__NOTE(_C5));
+    const uint8_t tempo       = 97; // durations don't divide evenly
+
+    struct step {
+        uint32_t start;
+        float    pitch;
+    };
+    std::vector<step> expected;
+    uint32_t          t = 0;
+    for (size_t i = 0; i < (size_t)NOTE_ARRAY_SIZE(melody); ++i) {
+        if (i > 0 && melody[i][0] == melody[i - 1][0]) {
+            // repeated notes are separated by a short rest
+            expected.push_back({t, 0.0f});
+            t += (uint32_t)(2 * 60000.0 / (64.0 * tempo));
+        }
+        expected.push_back({t, melody[i][0]});
+        t += (uint32_t)(melody[i][1] * 60000.0 / (64.0 * tempo));
+    }
+    const uint32_t end = t;
+
+    audio_set_tempo(tempo);
+    PLAY_SONG(melody);
+
+    std::vector<step> actual = {{0, audio_get_frequency(0)}};
+    uint32_t          now    = 0;
+    while (audio_is_playing_melody() && now <= end) {
+        set_time(++now);
+        audio_update_state();
+        if (audio_is_playing_melody() && audio_get_frequency(0) != actual.back().pitch) {
+            actual.push_back({now, audio_get_frequency(0)});
+        }
+    }
+    EXPECT_FALSE(audio_is_playing_melody());
+    EXPECT_EQ(now, end);
+
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(actual[i].start, expected[i].start) << "step " << i;
+        EXPECT_NEAR(actual[i].pitch, expected[i].pitch, 1.0f / 65536) << "step " << i;
+    }
+}
+
+TEST_F(AudioFixedPointTest, VibratoMatchesFloatVoice) {
+    set_voice(vibrating);
+    audio_play_tone(NOTE_A4);
+
+    for (uint16_t now = 0; now < 20000; now += 3) {
+        set_time(now);
+        float expected = reference_vibrato(NOTE_A4, now);
+        ASSERT_NEAR(audio_get_processed_frequency(0), expected, expected * 2e-5f) << "at " << now << "ms";
+    }
+}
+
+TEST_F(AudioFixedPointTest, DelayedVibratoMatchesFloatVoice) {
+    set_voice(delayed_vibrato);
+    audio_play_tone(NOTE_E5);
+
+    for (uint16_t index = 0; index < 600; ++index) {
+        set_time(voices_timer + index * 100);
+        float expected = index <= 150 ? NOTE_E5 : reference_delayed_vibrato(NOTE_E5, index);
+        ASSERT_NEAR(audio_get_processed_frequency(0), expected, expected * 2e-5f) << "at index " << index;
+    }
+}
+
+TEST_F(AudioFixedPointTest, VoiceTimbreMatchesFloatVoice) {
+    audio_play_tone(NOTE_C5);
+
+    set_voice(butts_fader);
+    for (uint16_t index = 20; index <= 200; ++index) {
+        set_time(voices_timer + index * 100);
+        audio_get_processed_frequency_fixed(0);
+        ASSERT_EQ(note_timbre, reference_butts_fader_timbre(index)) << "at index " << index;
+    }
+
+    set_voice(duty_octave_down);
+    for (uint16_t index = 0; index <= 100; ++index) {
+        set_time(voices_timer + index);
+        audio_get_processed_frequency_fixed(0);
+        ASSERT_EQ(note_timbre, reference_duty_octave_down_timbre(index)) << "at index " << index;
+    }
+}
+
+} // namespace
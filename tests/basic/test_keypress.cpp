@@ -290,3 +290,86 @@ TEST_F(KeyPress, PressEqualPlusDontReleaseBeforePress) {
     run_one_scan_loop();
     VERIFY_AND_CLEAR(driver);
 }
+
+TEST_F(KeyPress, SeventhKeyTakesTheFirstFreedSlot) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c = KeymapKey(0, 2, 0, KC_C);
+    auto       key_d = KeymapKey(0, 3, 0, KC_D);
+    auto       key_e = KeymapKey(0, 4, 0, KC_E);
+    auto       key_f = KeymapKey(0, 5, 0, KC_F);
+    auto       key_g = KeymapKey(0, 6, 0, KC_G);
+
+    set_keymap({key_a, key_b, key_c, key_d, key_e, key_f, key_g});
+
+    key_a.press();
+    key_b.press();
+    key_c.press();
+    key_d.press();
+    key_e.press();
+    key_f.press();
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D, KC_E));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D, KC_E, KC_F));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // No room in the report, so nothing changes for the host
+    key_g.press();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Releasing a key frees its slot for the key still being held
+    key_c.release();
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_D, KC_E, KC_F, KC_G));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_a.release();
+    key_b.release();
+    key_d.release();
+    key_e.release();
+    key_f.release();
+    key_g.release();
+    EXPECT_REPORT(driver, (KC_B, KC_D, KC_E, KC_F, KC_G));
+    EXPECT_REPORT(driver, (KC_D, KC_E, KC_F, KC_G));
+    EXPECT_REPORT(driver, (KC_E, KC_F, KC_G));
+    EXPECT_REPORT(driver, (KC_F, KC_G));
+    EXPECT_REPORT(driver, (KC_G));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyPress, UnchangedKeysAreNotResent) {
+    TestDriver driver;
+    InSequence s;
+
+    // A key added and removed again between reports leaves nothing to send
+    EXPECT_NO_REPORT(driver);
+    ::add_key(KC_A);
+    ::del_key(KC_A);
+    send_keyboard_report();
+    ::add_key(KC_B);
+    ::add_key(KC_B);
+    ::del_key(KC_B);
+    send_keyboard_report();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_C));
+    ::add_key(KC_C);
+    send_keyboard_report();
+    send_keyboard_report();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    ::clear_keys();
+    send_keyboard_report();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,42 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bench_fixture.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+// Uses the default dictionary of 70 entries
+
+class AutoCorrectBench : public BenchFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+        set_qwerty_keymap();
+    }
+};
+
+TEST_F(AutoCorrectBench, prose) {
+    replay(typing("the quick brown fox jumps over the lazy dog, then Sphinx of black quartz judges my vow.\n"));
+}
+
+TEST_F(AutoCorrectBench, typos) {
+    replay(typing("i will aquire the apparant ture value becuase the fitler is fales; the the cosnt is choosen.\n"));
+}
+
+TEST_F(AutoCorrectBench, recorded) {
+    // Typing "fales " with the key logging example of the debugging FAQ
+    replay(BenchTrace::parse(R"(
+KL: kc: 0x0009, col: 3, row: 1, pressed: 1, time: 15505, int: 0, count: 0
+KL: kc: 0x0009, col: 3, row: 1, pressed: 0, time: 15581, int: 0, count: 0
+KL: kc: 0x0004, col: 0, row: 1, pressed: 1, time: 15662, int: 0, count: 0
+KL: kc: 0x000F, col: 8, row: 1, pressed: 1, time: 15703, int: 0, count: 0
+KL: kc: 0x0004, col: 0, row: 1, pressed: 0, time: 15729, int: 0, count: 0
+KL: kc: 0x000F, col: 8, row: 1, pressed: 0, time: 15790, int: 0, count: 0
+KL: kc: 0x0008, col: 2, row: 0, pressed: 1, time: 15861, int: 0, count: 0
+KL: kc: 0x0008, col: 2, row: 0, pressed: 0, time: 15933, int: 0, count: 0
+KL: kc: 0x0016, col: 1, row: 1, pressed: 1, time: 15978, int: 0, count: 0
+KL: kc: 0x0016, col: 1, row: 1, pressed: 0, time: 16052, int: 0, count: 0
+KL: kc: 0x002C, col: 5, row: 3, pressed: 1, time: 16130, int: 0, count: 0
+KL: kc: 0x002C, col: 5, row: 3, pressed: 0, time: 16201, int: 0, count: 0
+)"));
+}
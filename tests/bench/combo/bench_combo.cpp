@@ -0,0 +1,35 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bench_fixture.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+class ComboBench : public BenchFixture {
+   public:
+    void SetUp() override {
+        set_qwerty_keymap();
+    }
+};
+
+TEST_F(ComboBench, prose) {
+    replay(typing("the quick brown fox jumps over the lazy dog, then Sphinx of black quartz judges my vow.\n"));
+}
+
+TEST_F(ComboBench, fast_typing) {
+    // Quick taps of adjacent combo keys, each of which starts a combo that never completes
+    replay(typing("asdf jkl; qwer uiop zxcv nm,. ", 40, 15));
+}
+
+TEST_F(ComboBench, chords) {
+    KeymapKey key_q(0, 0, 0, KC_Q), key_w(0, 1, 0, KC_W), key_e(0, 2, 0, KC_E);
+    KeymapKey key_a(0, 0, 1, KC_A), key_s(0, 1, 1, KC_S), key_d(0, 2, 1, KC_D);
+    KeymapKey key_j(0, 6, 1, KC_J), key_k(0, 7, 1, KC_K), key_l(0, 8, 1, KC_L);
+
+    BenchTrace trace;
+    trace.chord({key_q, key_w}).chord({key_a, key_s, key_d}).chord({key_j, key_k}).chord({key_q, key_a});
+    trace.chord({key_j, key_k, key_l}).chord({key_s, key_d}, TAPPING_TERM + 50).chord({key_e, key_d});
+    trace.append(typing("hello world ")).idle(TAPPING_TERM);
+
+    replay(trace);
+}
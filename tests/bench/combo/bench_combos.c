@@ -0,0 +1,33 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// Every horizontally and vertically adjacent pair of letters on the QWERTY keymap, plus a few triples
+
+#define PAIR(a, b) const uint16_t PROGMEM combo_##a##_##b[] = {KC_##a, KC_##b, COMBO_END};
+#define TRIPLE(a, b, c) const uint16_t PROGMEM combo_##a##_##b##_##c[] = {KC_##a, KC_##b, KC_##c, COMBO_END};
+
+// clang-format off
+PAIR(Q, W) PAIR(W, E) PAIR(E, R) PAIR(R, T) PAIR(T, Y) PAIR(Y, U) PAIR(U, I) PAIR(I, O) PAIR(O, P)
+PAIR(A, S) PAIR(S, D) PAIR(D, F) PAIR(F, G) PAIR(G, H) PAIR(H, J) PAIR(J, K) PAIR(K, L)
+PAIR(Z, X) PAIR(X, C) PAIR(C, V) PAIR(V, B) PAIR(B, N) PAIR(N, M)
+PAIR(Q, A) PAIR(W, S) PAIR(E, D) PAIR(R, F) PAIR(T, G) PAIR(Y, H) PAIR(U, J) PAIR(I, K) PAIR(O, L)
+PAIR(A, Z) PAIR(S, X) PAIR(D, C) PAIR(F, V) PAIR(G, B) PAIR(H, N) PAIR(J, M)
+TRIPLE(Q, W, E) TRIPLE(A, S, D) TRIPLE(Z, X, C) TRIPLE(U, I, O) TRIPLE(J, K, L) TRIPLE(E, R, T)
+
+combo_t key_combos[] = {
+    COMBO(combo_Q_W, KC_ESC),  COMBO(combo_W_E, KC_TAB),  COMBO(combo_E_R, KC_GRV),  COMBO(combo_R_T, KC_MINS),
+    COMBO(combo_T_Y, KC_EQL),  COMBO(combo_Y_U, KC_LBRC), COMBO(combo_U_I, KC_RBRC), COMBO(combo_I_O, KC_BSLS),
+    COMBO(combo_O_P, KC_BSPC), COMBO(combo_A_S, KC_QUOT), COMBO(combo_S_D, KC_LCTL), COMBO(combo_D_F, KC_ENT),
+    COMBO(combo_F_G, KC_LALT), COMBO(combo_G_H, KC_CAPS), COMBO(combo_H_J, KC_LEFT), COMBO(combo_J_K, KC_ESC),
+    COMBO(combo_K_L, KC_RGHT), COMBO(combo_Z_X, KC_UNDO), COMBO(combo_X_C, KC_CUT),  COMBO(combo_C_V, KC_COPY),
+    COMBO(combo_V_B, KC_PSTE), COMBO(combo_B_N, KC_DEL),  COMBO(combo_N_M, KC_HOME), COMBO(combo_Q_A, KC_F1),
+    COMBO(combo_W_S, KC_F2),   COMBO(combo_E_D, KC_F3),   COMBO(combo_R_F, KC_F4),   COMBO(combo_T_G, KC_F5),
+    COMBO(combo_Y_H, KC_F6),   COMBO(combo_U_J, KC_F7),   COMBO(combo_I_K, KC_F8),   COMBO(combo_O_L, KC_F9),
+    COMBO(combo_A_Z, KC_F10),  COMBO(combo_S_X, KC_F11),  COMBO(combo_D_C, KC_F12),  COMBO(combo_F_V, KC_PGUP),
+    COMBO(combo_G_B, KC_PGDN), COMBO(combo_H_N, KC_END),  COMBO(combo_J_M, KC_INS),  COMBO(combo_Q_W_E, KC_F13),
+    COMBO(combo_A_S_D, KC_F14), COMBO(combo_Z_X_C, KC_F15), COMBO(combo_U_I_O, KC_F16), COMBO(combo_J_K_L, KC_F17),
+    COMBO(combo_E_R_T, KC_F18),
+};
+// clang-format on
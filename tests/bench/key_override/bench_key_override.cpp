@@ -0,0 +1,45 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bench_fixture.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+class KeyOverrideBench : public BenchFixture {
+   public:
+    void SetUp() override {
+        // Control replaces tab, so both shift and control can be held on row 3
+        set_qwerty_keymap({KeymapKey(0, 9, 3, KC_LCTL)});
+    }
+};
+
+TEST_F(KeyOverrideBench, prose) {
+    replay(typing("The quick brown fox jumps over the lazy dog, then Sphinx of black quartz judges my vow.\n"));
+}
+
+TEST_F(KeyOverrideBench, shifted_overrides) {
+    KeymapKey key_shift(0, 6, 3, KC_LSFT), key_1(0, 0, 3, KC_1), key_4(0, 3, 3, KC_4);
+    KeymapKey key_bspc(0, 8, 3, KC_BSPC), key_comma(0, 7, 2, KC_COMM), key_slash(0, 9, 2, KC_SLSH);
+
+    BenchTrace trace;
+    trace.press(key_shift, 60).tap(key_1).tap(key_4).tap(key_bspc).tap(key_comma).tap(key_slash).release(key_shift, 30);
+    trace.append(typing("abc 123 "));
+    trace.press(key_shift, 60).tap(key_bspc).release(key_shift, 5).tap(key_bspc, 30, 5);
+
+    replay(trace);
+}
+
+TEST_F(KeyOverrideBench, control_navigation) {
+    KeymapKey key_ctrl(0, 9, 3, KC_LCTL), key_shift(0, 6, 3, KC_LSFT);
+    KeymapKey key_h(0, 5, 1, KC_H), key_j(0, 6, 1, KC_J), key_k(0, 7, 1, KC_K), key_l(0, 8, 1, KC_L);
+    KeymapKey key_z(0, 0, 2, KC_Z), key_c(0, 2, 2, KC_C), key_x(0, 1, 2, KC_X);
+
+    BenchTrace trace;
+    trace.press(key_ctrl, 60);
+    for (int i = 0; i < 4; i++) {
+        trace.tap(key_h).tap(key_j).tap(key_k).tap(key_l);
+    }
+    trace.tap(key_x).press(key_shift, 30).tap(key_z).tap(key_c).release(key_shift, 30).release(key_ctrl, 30);
+
+    replay(trace);
+}
@@ -0,0 +1,33 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL),
+    &ko_make_basic(MOD_MASK_SHIFT, KC_ENTER, KC_ESC),
+    &ko_make_basic(MOD_MASK_SHIFT, KC_TAB, KC_CAPS),
+    &ko_make_basic(MOD_MASK_SHIFT, KC_COMM, KC_SCLN),
+    &ko_make_basic(MOD_MASK_SHIFT, KC_DOT, KC_COLN),
+    &ko_make_basic(MOD_MASK_SHIFT, KC_1, KC_6),
+    &ko_make_basic(MOD_MASK_SHIFT, KC_2, KC_7),
+    &ko_make_basic(MOD_MASK_SHIFT, KC_3, KC_8),
+    &ko_make_basic(MOD_MASK_SHIFT, KC_4, KC_9),
+    &ko_make_basic(MOD_MASK_SHIFT, KC_5, KC_0),
+    &ko_make_basic(MOD_MASK_CTRL, KC_H, KC_LEFT),
+    &ko_make_basic(MOD_MASK_CTRL, KC_J, KC_DOWN),
+    &ko_make_basic(MOD_MASK_CTRL, KC_K, KC_UP),
+    &ko_make_basic(MOD_MASK_CTRL, KC_L, KC_RIGHT),
+    &ko_make_basic(MOD_MASK_CTRL, KC_U, KC_PGUP),
+    &ko_make_basic(MOD_MASK_CTRL, KC_D, KC_PGDN),
+    &ko_make_basic(MOD_MASK_CTRL, KC_A, KC_HOME),
+    &ko_make_basic(MOD_MASK_CTRL, KC_E, KC_END),
+    &ko_make_basic(MOD_MASK_ALT, KC_B, C(KC_LEFT)),
+    &ko_make_basic(MOD_MASK_ALT, KC_F, C(KC_RIGHT)),
+    &ko_make_basic(MOD_MASK_CS, KC_Z, C(KC_Y)),
+    &ko_make_basic(MOD_MASK_CS, KC_C, KC_COPY),
+    &ko_make_basic(MOD_MASK_CS, KC_V, KC_PSTE),
+    &ko_make_with_layers_and_negmods(MOD_MASK_SHIFT, KC_SLSH, KC_BSLS, ~0, MOD_MASK_CTRL),
+};
+// clang-format on
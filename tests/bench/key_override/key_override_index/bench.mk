@@ -0,0 +1,12 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains benchmarks
+# --------------------------------------------------------------------------------
+
+KEY_OVERRIDE_ENABLE = yes
+
+# Same overrides and traces as the parent benchmark, looked up through the index
+INTROSPECTION_KEYMAP_C = ../bench_key_overrides.c
+SRC += tests/bench/key_override/bench_key_override.cpp
@@ -0,0 +1,34 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bench_fixture.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+class LeaderBench : public BenchFixture {
+   public:
+    void SetUp() override {
+        set_qwerty_keymap({KeymapKey(0, 9, 3, QK_LEADER)});
+    }
+
+    BenchTrace sequence(const std::string& keys) {
+        KeymapKey key_leader(0, 9, 3, QK_LEADER);
+
+        BenchTrace trace;
+        trace.tap(key_leader).append(typing(keys)).idle(LEADER_TIMEOUT + 10);
+        return trace;
+    }
+};
+
+TEST_F(LeaderBench, prose) {
+    replay(typing("the quick brown fox jumps over the lazy dog, then Sphinx of black quartz judges my vow.\n"));
+}
+
+TEST_F(LeaderBench, sequences) {
+    BenchTrace trace;
+    for (const char* keys : {"q", "y", "as", "ff", "hh", "git", "gic", "vim", "xxx", "zzz", "nope"}) {
+        trace.append(sequence(keys)).append(typing("ok "));
+    }
+
+    replay(trace);
+}
@@ -0,0 +1,33 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// A large leader_end_user(), checked sequence by sequence like most keymaps do
+
+#define ONE(a, out)                        \
+    if (leader_sequence_one_key(KC_##a)) { \
+        tap_code(out);                     \
+        return;                            \
+    }
+#define TWO(a, b, out)                              \
+    if (leader_sequence_two_keys(KC_##a, KC_##b)) { \
+        tap_code(out);                              \
+        return;                                     \
+    }
+#define THREE(a, b, c, out)                                   \
+    if (leader_sequence_three_keys(KC_##a, KC_##b, KC_##c)) { \
+        tap_code(out);                                        \
+        return;                                               \
+    }
+
+void leader_end_user(void) {
+    // clang-format off
+    ONE(Q, KC_F1) ONE(W, KC_F2) ONE(E, KC_F3) ONE(R, KC_F4) ONE(T, KC_F5) ONE(Y, KC_F6)
+    TWO(A, A, KC_F7) TWO(A, S, KC_F8) TWO(A, D, KC_F9) TWO(A, F, KC_F10) TWO(S, A, KC_F11) TWO(S, S, KC_F12)
+    TWO(S, D, KC_F13) TWO(S, F, KC_F14) TWO(D, A, KC_F15) TWO(D, S, KC_F16) TWO(D, D, KC_F17) TWO(D, F, KC_F18)
+    TWO(F, A, KC_F19) TWO(F, S, KC_F20) TWO(F, D, KC_F21) TWO(F, F, KC_F22) TWO(G, G, KC_F23) TWO(H, H, KC_F24)
+    THREE(G, I, T, KC_1) THREE(G, I, P, KC_2) THREE(G, I, S, KC_3) THREE(G, I, C, KC_4) THREE(V, I, M, KC_5)
+    THREE(V, I, S, KC_6) THREE(V, I, W, KC_7) THREE(V, I, Q, KC_8) THREE(Z, Z, Z, KC_9) THREE(X, X, X, KC_0)
+    // clang-format on
+}
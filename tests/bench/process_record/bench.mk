@@ -0,0 +1,13 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains benchmarks
+# --------------------------------------------------------------------------------
+
+AUDIO_ENABLE = yes
+AUTOCORRECT_ENABLE = yes
+CAPS_WORD_ENABLE = yes
+DYNAMIC_TAPPING_TERM_ENABLE = yes
+TRI_LAYER_ENABLE = yes
+UNICODE_ENABLE = yes
@@ -0,0 +1,21 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bench_fixture.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+// Enables a mix of features whose handlers only care about their own keycode range (audio, dynamic tapping
+// term, tri layer, unicode, magic, grave escape) and ones that look at every key (caps word, autocorrect,
+// space cadet), so the trace measures the per-event cost of process_record_quantum()'s handler chain.
+
+class ProcessRecordBench : public BenchFixture {
+   public:
+    void SetUp() override {
+        set_qwerty_keymap();
+    }
+};
+
+TEST_F(ProcessRecordBench, prose) {
+    replay(typing("the quick brown fox jumps over the lazy dog, then Sphinx of black quartz judges my vow.\n"));
+}
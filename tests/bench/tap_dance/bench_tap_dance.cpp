@@ -0,0 +1,57 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bench_fixture.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+class TapDanceBench : public BenchFixture {
+   public:
+    void SetUp() override {
+        // Every key of row 3 except space and shift, and the punctuation of row 2, is a tap dance
+        set_qwerty_keymap({
+            KeymapKey(0, 0, 3, TD(0)),
+            KeymapKey(0, 1, 3, TD(1)),
+            KeymapKey(0, 2, 3, TD(2)),
+            KeymapKey(0, 3, 3, TD(3)),
+            KeymapKey(0, 4, 3, TD(4)),
+            KeymapKey(0, 7, 2, TD(5)),
+            KeymapKey(0, 8, 2, TD(6)),
+            KeymapKey(0, 9, 2, TD(7)),
+            KeymapKey(0, 7, 3, TD(8)),
+            KeymapKey(0, 8, 3, TD(9)),
+            KeymapKey(0, 9, 3, TD(20)),
+        });
+    }
+};
+
+TEST_F(TapDanceBench, prose) {
+    // Letters are plain keys, so this measures the cost of tap dance on keys which are not dances
+    replay(typing("the quick brown fox jumps over the lazy dog then sphinx of black quartz judges my vow "));
+}
+
+TEST_F(TapDanceBench, single_and_double_taps) {
+    KeymapKey key_comma(0, 7, 2, TD(5)), key_dot(0, 8, 2, TD(6)), key_enter(0, 7, 3, TD(8));
+    KeymapKey key_1(0, 0, 3, TD(0)), key_3(0, 2, 3, TD(2)), key_count(0, 9, 3, TD(20));
+
+    BenchTrace trace = typing("hello");
+    trace.tap(key_comma).idle(TAPPING_TERM).append(typing(" world"));
+    trace.tap(key_dot).tap(key_dot).idle(TAPPING_TERM);
+    trace.tap(key_1).tap(key_3).tap(key_3).idle(TAPPING_TERM);
+    trace.tap(key_count).tap(key_count).tap(key_count).idle(TAPPING_TERM);
+    trace.append(typing("abc")).tap(key_enter).tap(key_enter).idle(TAPPING_TERM);
+
+    replay(trace);
+}
+
+TEST_F(TapDanceBench, interrupted_dances) {
+    KeymapKey key_comma(0, 7, 2, TD(5)), key_2(0, 1, 3, TD(1)), key_4(0, 3, 3, TD(3));
+
+    BenchTrace trace;
+    for (int i = 0; i < 8; i++) {
+        trace.tap(key_comma, 20, 20).append(typing("ab", 20, 20)).tap(key_2, 20, 20).tap(key_4, 20, 20).append(typing("c", 20, 20));
+    }
+    trace.idle(TAPPING_TERM);
+
+    replay(trace);
+}
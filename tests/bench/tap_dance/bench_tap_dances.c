@@ -0,0 +1,25 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+static void dance_count_finished(tap_dance_state_t *state, void *user_data) {
+    tap_code(state->count >= 3 ? KC_3 : KC_1 + state->count - 1);
+}
+
+// clang-format off
+tap_dance_action_t tap_dance_actions[] = {
+    ACTION_TAP_DANCE_DOUBLE(KC_1, KC_EXLM),   ACTION_TAP_DANCE_DOUBLE(KC_2, KC_AT),
+    ACTION_TAP_DANCE_DOUBLE(KC_3, KC_HASH),   ACTION_TAP_DANCE_DOUBLE(KC_4, KC_DLR),
+    ACTION_TAP_DANCE_DOUBLE(KC_5, KC_PERC),   ACTION_TAP_DANCE_DOUBLE(KC_COMM, KC_SCLN),
+    ACTION_TAP_DANCE_DOUBLE(KC_DOT, KC_COLN), ACTION_TAP_DANCE_DOUBLE(KC_SLSH, KC_QUES),
+    ACTION_TAP_DANCE_DOUBLE(KC_ENT, KC_ESC),  ACTION_TAP_DANCE_DOUBLE(KC_BSPC, KC_DEL),
+    ACTION_TAP_DANCE_DOUBLE(KC_TAB, KC_CAPS), ACTION_TAP_DANCE_DOUBLE(KC_MINS, KC_UNDS),
+    ACTION_TAP_DANCE_DOUBLE(KC_EQL, KC_PLUS), ACTION_TAP_DANCE_DOUBLE(KC_LBRC, KC_LCBR),
+    ACTION_TAP_DANCE_DOUBLE(KC_RBRC, KC_RCBR), ACTION_TAP_DANCE_DOUBLE(KC_QUOT, KC_DQUO),
+    ACTION_TAP_DANCE_DOUBLE(KC_GRV, KC_TILD), ACTION_TAP_DANCE_DOUBLE(KC_BSLS, KC_PIPE),
+    ACTION_TAP_DANCE_DOUBLE(KC_HOME, KC_END), ACTION_TAP_DANCE_DOUBLE(KC_PGUP, KC_PGDN),
+    ACTION_TAP_DANCE_FN(dance_count_finished), ACTION_TAP_DANCE_FN(dance_count_finished),
+    ACTION_TAP_DANCE_FN(dance_count_finished), ACTION_TAP_DANCE_FN(dance_count_finished),
+};
+// clang-format on
@@ -0,0 +1,146 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "quantum.h"
+#include "keycode.h"
+#include "test_common.h"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class ComboIndex : public TestFixture {};
+
+TEST_F(ComboIndex, two_key_combo_tapped) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(0, 0, 1, KC_B);
+    set_keymap({key_a, key_b});
+
+    EXPECT_REPORT(driver, (KC_ESC));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, combo_keys_listed_out_of_keycode_order) {
+    TestDriver driver;
+    KeymapKey  key_b(0, 0, 1, KC_B);
+    KeymapKey  key_c(0, 0, 2, KC_C);
+    set_keymap({key_b, key_c});
+
+    EXPECT_REPORT(driver, (KC_TAB));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_c, key_b});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, longer_overlapping_combo_wins) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(0, 0, 1, KC_B);
+    KeymapKey  key_c(0, 0, 2, KC_C);
+    set_keymap({key_a, key_b, key_c});
+
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b, key_c});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, non_combo_key_is_not_delayed) {
+    TestDriver driver;
+    KeymapKey  key_f(0, 0, 3, KC_F);
+    set_keymap({key_f});
+
+    EXPECT_REPORT(driver, (KC_F));
+    key_f.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_f.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, in_order_combo_pressed_in_order) {
+    TestDriver driver;
+    KeymapKey  key_d(0, 1, 0, KC_D);
+    KeymapKey  key_e(0, 1, 1, KC_E);
+    set_keymap({key_d, key_e});
+
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_d, key_e});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, in_order_combo_pressed_out_of_order) {
+    TestDriver driver;
+    KeymapKey  key_d(0, 1, 0, KC_D);
+    KeymapKey  key_e(0, 1, 1, KC_E);
+    set_keymap({key_d, key_e});
+
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_REPORT(driver, (KC_E, KC_D));
+    EXPECT_REPORT(driver, (KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_e, key_d});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, must_hold_combo_held) {
+    TestDriver driver;
+    KeymapKey  key_g(0, 1, 2, KC_G);
+    KeymapKey  key_h(0, 1, 3, KC_H);
+    set_keymap({key_g, key_h});
+
+    EXPECT_REPORT(driver, (KC_Y));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_g, key_h}, COMBO_HOLD_TERM + 10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, must_hold_combo_tapped) {
+    TestDriver driver;
+    KeymapKey  key_g(0, 1, 2, KC_G);
+    KeymapKey  key_h(0, 1, 3, KC_H);
+    set_keymap({key_g, key_h});
+
+    EXPECT_REPORT(driver, (KC_G));
+    EXPECT_REPORT(driver, (KC_G, KC_H));
+    EXPECT_REPORT(driver, (KC_H));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_g, key_h});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, must_tap_combo_tapped) {
+    TestDriver driver;
+    KeymapKey  key_i(0, 2, 0, KC_I);
+    KeymapKey  key_j(0, 2, 1, KC_J);
+    set_keymap({key_i, key_j});
+
+    EXPECT_REPORT(driver, (KC_Z));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_i, key_j});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, must_tap_combo_held) {
+    TestDriver driver;
+    KeymapKey  key_i(0, 2, 0, KC_I);
+    KeymapKey  key_j(0, 2, 1, KC_J);
+    set_keymap({key_i, key_j});
+
+    EXPECT_REPORT(driver, (KC_I));
+    EXPECT_REPORT(driver, (KC_I, KC_J));
+    EXPECT_REPORT(driver, (KC_J));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_i, key_j}, COMBO_HOLD_TERM + 10);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,35 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum combos { ab_esc, bc_tab, abc_enter, de_in_order, gh_hold, ij_tap };
+
+uint16_t const ab_combo[]  = {KC_A, KC_B, COMBO_END};
+uint16_t const bc_combo[]  = {KC_C, KC_B, COMBO_END};
+uint16_t const abc_combo[] = {KC_A, KC_B, KC_C, COMBO_END};
+uint16_t const de_combo[]  = {KC_D, KC_E, COMBO_END};
+uint16_t const gh_combo[]  = {KC_G, KC_H, COMBO_END};
+uint16_t const ij_combo[]  = {KC_I, KC_J, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [ab_esc]      = COMBO(ab_combo, KC_ESC),
+    [bc_tab]      = COMBO(bc_combo, KC_TAB),
+    [abc_enter]   = COMBO(abc_combo, KC_ENTER),
+    [de_in_order] = COMBO(de_combo, KC_X),
+    [gh_hold]     = COMBO(gh_combo, KC_Y),
+    [ij_tap]      = COMBO(ij_combo, KC_Z),
+};
+// clang-format on
+
+bool get_combo_must_press_in_order(uint16_t combo_index, combo_t *combo) {
+    return combo_index == de_in_order;
+}
+
+bool get_combo_must_hold(uint16_t combo_index, combo_t *combo) {
+    return combo_index == gh_hold;
+}
+
+bool get_combo_must_tap(uint16_t combo_index, combo_t *combo) {
+    return combo_index == ij_tap;
+}
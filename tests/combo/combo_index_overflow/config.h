@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TAPPING_TERM 200
+
+// Smaller than the 7 keys of the test combos, so the linear scan is used
+#define COMBO_INDEX_LENGTH 4
@@ -0,0 +1,56 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "quantum.h"
+#include "keycode.h"
+#include "test_common.h"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class ComboIndexOverflow : public TestFixture {};
+
+TEST_F(ComboIndexOverflow, combo_past_end_of_index_tapped) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(0, 0, 1, KC_B);
+    KeymapKey  key_c(0, 0, 2, KC_C);
+    set_keymap({key_a, key_b, key_c});
+
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b, key_c});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndexOverflow, combo_inside_index_tapped) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(0, 0, 1, KC_B);
+    set_keymap({key_a, key_b});
+
+    EXPECT_REPORT(driver, (KC_ESC));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndexOverflow, non_combo_key_is_not_delayed) {
+    TestDriver driver;
+    KeymapKey  key_f(0, 0, 3, KC_F);
+    set_keymap({key_f});
+
+    EXPECT_REPORT(driver, (KC_F));
+    key_f.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_f.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
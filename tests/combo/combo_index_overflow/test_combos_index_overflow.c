@@ -0,0 +1,17 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum combos { ab_esc, bc_tab, abc_enter };
+
+uint16_t const ab_combo[]  = {KC_A, KC_B, COMBO_END};
+uint16_t const bc_combo[]  = {KC_C, KC_B, COMBO_END};
+uint16_t const abc_combo[] = {KC_A, KC_B, KC_C, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [ab_esc]    = COMBO(ab_combo, KC_ESC),
+    [bc_tab]    = COMBO(bc_combo, KC_TAB),
+    [abc_enter] = COMBO(abc_combo, KC_ENTER),
+};
+// clang-format on
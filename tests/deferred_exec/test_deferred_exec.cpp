@@ -0,0 +1,109 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+void advance_time(uint32_t ms);
+}
+
+#define TEST_EXECUTORS 4
+
+static std::vector<uintptr_t> executions;
+
+static uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    executions.push_back((uintptr_t)cb_arg);
+    return 0;
+}
+
+static uint32_t repeat_callback(uint32_t trigger_time, void *cb_arg) {
+    executions.push_back((uintptr_t)cb_arg);
+    return 10;
+}
+
+class DeferredExec : public TestFixture {
+   protected:
+    deferred_executor_t table[TEST_EXECUTORS] = {};
+    uint32_t            last_exec             = 0;
+
+    void SetUp() override {
+        executions.clear();
+        last_exec = timer_read32();
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; ++i) {
+            advance_time(1);
+            deferred_exec_advanced_task(table, TEST_EXECUTORS, &last_exec);
+        }
+    }
+};
+
+TEST_F(DeferredExec, ExecutesInDeadlineOrder) {
+    EXPECT_NE(defer_exec_advanced(table, TEST_EXECUTORS, 30, record_callback, (void *)3), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer_exec_advanced(table, TEST_EXECUTORS, 10, record_callback, (void *)1), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer_exec_advanced(table, TEST_EXECUTORS, 20, record_callback, (void *)2), INVALID_DEFERRED_TOKEN);
+
+    run_for(9);
+    EXPECT_TRUE(executions.empty());
+    EXPECT_EQ(deferred_exec_advanced_time_until_next(table, TEST_EXECUTORS), 1);
+
+    run_for(21);
+    EXPECT_EQ(executions, (std::vector<uintptr_t>{1, 2, 3}));
+    EXPECT_EQ(deferred_exec_advanced_time_until_next(table, TEST_EXECUTORS), DEFERRED_EXEC_IDLE);
+}
+
+TEST_F(DeferredExec, ExtendAndCancel) {
+    deferred_token first  = defer_exec_advanced(table, TEST_EXECUTORS, 10, record_callback, (void *)1);
+    deferred_token second = defer_exec_advanced(table, TEST_EXECUTORS, 20, record_callback, (void *)2);
+    deferred_token third  = defer_exec_advanced(table, TEST_EXECUTORS, 30, record_callback, (void *)3);
+
+    EXPECT_TRUE(extend_deferred_exec_advanced(table, TEST_EXECUTORS, first, 40));
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, TEST_EXECUTORS, second));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, TEST_EXECUTORS, second));
+    EXPECT_EQ(deferred_exec_advanced_time_until_next(table, TEST_EXECUTORS), 30);
+
+    run_for(40);
+    EXPECT_EQ(executions, (std::vector<uintptr_t>{3, 1}));
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, TEST_EXECUTORS, third, 10));
+}
+
+TEST_F(DeferredExec, RepeatsUntilCancelled) {
+    deferred_token token = defer_exec_advanced(table, TEST_EXECUTORS, 10, repeat_callback, (void *)1);
+    EXPECT_NE(defer_exec_advanced(table, TEST_EXECUTORS, 25, record_callback, (void *)2), INVALID_DEFERRED_TOKEN);
+
+    run_for(35);
+    EXPECT_EQ(executions, (std::vector<uintptr_t>{1, 1, 2, 1}));
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, TEST_EXECUTORS, token));
+    run_for(50);
+    EXPECT_EQ(executions.size(), 4);
+}
+
+TEST_F(DeferredExec, TableFull) {
+    for (uintptr_t i = 0; i < TEST_EXECUTORS; ++i) {
+        EXPECT_NE(defer_exec_advanced(table, TEST_EXECUTORS, 10 + i, record_callback, (void *)i), INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer_exec_advanced(table, TEST_EXECUTORS, 10, record_callback, NULL), INVALID_DEFERRED_TOKEN);
+
+    run_for(10);
+    EXPECT_EQ(executions, (std::vector<uintptr_t>{0}));
+    EXPECT_NE(defer_exec_advanced(table, TEST_EXECUTORS, 10, record_callback, NULL), INVALID_DEFERRED_TOKEN);
+}
+
+TEST_F(DeferredExec, LateRepeaterDoesNotStarveOthers) {
+    EXPECT_NE(defer_exec_advanced(table, TEST_EXECUTORS, 10, repeat_callback, (void *)1), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer_exec_advanced(table, TEST_EXECUTORS, 25, record_callback, (void *)2), INVALID_DEFERRED_TOKEN);
+
+    // The repeater is still due after running, but only runs once per pass, and mustn't hold up the other executor
+    advance_time(50);
+    deferred_exec_advanced_task(table, TEST_EXECUTORS, &last_exec);
+    EXPECT_EQ(executions, (std::vector<uintptr_t>{1, 2}));
+
+    // It catches up on later passes
+    advance_time(1);
+    deferred_exec_advanced_task(table, TEST_EXECUTORS, &last_exec);
+    EXPECT_EQ(executions, (std::vector<uintptr_t>{1, 2, 1}));
+}
@@ -0,0 +1,66 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class DynamicKeymapMacroAsync : public TestFixture {
+   public:
+    void SetUp() override {
+        dynamic_keymap_macro_reset();
+    }
+
+    void set_macro(const char *macro) {
+        dynamic_keymap_macro_set_buffer(0, strlen(macro) + 1, (uint8_t *)macro);
+    }
+};
+
+TEST_F(DynamicKeymapMacroAsync, macro_is_streamed_from_the_main_loop) {
+    TestDriver driver;
+    set_macro("ab");
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(0);
+    EXPECT_TRUE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    idle_for(50);
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMacroAsync, macro_waits_for_string_being_queued) {
+    TestDriver driver;
+    set_macro("b");
+
+    {
+        InSequence s;
+        for (int i = 0; i < 20; i++) {
+            EXPECT_REPORT(driver, (KC_A));
+            EXPECT_EMPTY_REPORT(driver);
+        }
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    // Longer than the queue, so it is still being queued when the macro is sent
+    EXPECT_TRUE(send_string_async("aaaaaaaaaaaaaaaaaaaa", 0, NULL, NULL));
+    dynamic_keymap_macro_send(0);
+    idle_for(50);
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+}
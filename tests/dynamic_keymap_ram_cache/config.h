@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Room for two layers and the macros
+#define EEPROM_SIZE 512
+
+#define DYNAMIC_KEYMAP_LAYER_COUNT 2
+#define DYNAMIC_KEYMAP_RAM_CACHE
+#define DYNAMIC_KEYMAP_RAM_CACHE_WRITE_DELAY 100
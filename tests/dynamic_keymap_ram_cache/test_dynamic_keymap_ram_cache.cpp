@@ -0,0 +1,110 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "eeprom.h"
+}
+
+using testing::_;
+
+class DynamicKeymapRamCache : public TestFixture {
+   public:
+    void SetUp() override {
+        dynamic_keymap_reset();
+        dynamic_keymap_flush();
+    }
+
+    // The keycode stored in EEPROM, bypassing the RAM copy
+    uint16_t eeprom_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+        uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, column);
+        return (eeprom_read_byte(address) << 8) | eeprom_read_byte(address + 1);
+    }
+
+    void write_eeprom_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
+        uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, column);
+        eeprom_write_byte(address, keycode >> 8);
+        eeprom_write_byte(address + 1, keycode & 0xFF);
+    }
+};
+
+TEST_F(DynamicKeymapRamCache, reads_come_from_ram) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    dynamic_keymap_set_keycode(0, 1, 2, KC_A);
+    dynamic_keymap_flush();
+
+    // A change made to the EEPROM behind the RAM copy is not seen
+    write_eeprom_keycode(0, 1, 2, KC_B);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 2), KC_A);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapRamCache, write_is_flushed_after_delay) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    dynamic_keymap_set_keycode(0, 0, 0, KC_C);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), KC_C);
+    EXPECT_NE(eeprom_keycode(0, 0, 0), KC_C);
+
+    idle_for(DYNAMIC_KEYMAP_RAM_CACHE_WRITE_DELAY - 10);
+    EXPECT_NE(eeprom_keycode(0, 0, 0), KC_C);
+
+    // Another write restarts the delay
+    dynamic_keymap_set_keycode(0, 0, 1, KC_D);
+    idle_for(20);
+    EXPECT_NE(eeprom_keycode(0, 0, 0), KC_C);
+
+    idle_for(DYNAMIC_KEYMAP_RAM_CACHE_WRITE_DELAY);
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), KC_C);
+    EXPECT_EQ(eeprom_keycode(0, 0, 1), KC_D);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapRamCache, only_dirty_chunks_are_written) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    // Keys on different layers are in different chunks
+    write_eeprom_keycode(1, 0, 0, KC_E);
+    dynamic_keymap_set_keycode(0, 0, 0, KC_F);
+    idle_for(DYNAMIC_KEYMAP_RAM_CACHE_WRITE_DELAY + 10);
+
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), KC_F);
+    // The clean chunk was left alone, rather than overwritten from the RAM copy
+    EXPECT_EQ(eeprom_keycode(1, 0, 0), KC_E);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapRamCache, suspend_flushes_immediately) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    dynamic_keymap_set_keycode(1, 2, 3, KC_G);
+    EXPECT_NE(eeprom_keycode(1, 2, 3), KC_G);
+
+    suspend_power_down_quantum();
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), KC_G);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapRamCache, resets_are_written_through) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    // VIA marks its EEPROM as valid as soon as the resets return, so they can't wait for the delayed write
+    uint8_t *macros = (uint8_t *)dynamic_keymap_key_to_eeprom_address(0, 0, 0) + DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+    write_eeprom_keycode(0, 0, 0, KC_H);
+    eeprom_write_byte(macros, 'a');
+
+    dynamic_keymap_reset();
+    dynamic_keymap_macro_reset();
+    EXPECT_NE(eeprom_keycode(0, 0, 0), KC_H);
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), dynamic_keymap_get_keycode(0, 0, 0));
+    EXPECT_EQ(eeprom_read_byte(macros), 0);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,131 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class KeyOverrideIndex : public TestFixture {};
+
+TEST_F(KeyOverrideIndex, modifier_then_trigger) {
+    TestDriver driver;
+    auto       key_lsft = KeymapKey(0, 0, 0, KC_LEFT_SHIFT);
+    auto       key_bspc = KeymapKey(0, 1, 0, KC_BSPC);
+
+    set_keymap({key_lsft, key_bspc});
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    key_lsft.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    key_bspc.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    key_bspc.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_lsft.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, first_matching_override_wins) {
+    TestDriver driver;
+    auto       key_lsft = KeymapKey(0, 0, 0, KC_LEFT_SHIFT);
+    auto       key_a    = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_lsft, key_a});
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    key_lsft.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_lsft.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, modifier_after_held_trigger) {
+    TestDriver driver;
+    auto       key_lctl = KeymapKey(0, 0, 0, KC_LEFT_CTRL);
+    auto       key_h    = KeymapKey(0, 1, 0, KC_H);
+
+    set_keymap({key_lctl, key_h});
+
+    EXPECT_REPORT(driver, (KC_H));
+    key_h.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The override activates on the modifier, and registers its replacement after the repeat delay
+    {
+        InSequence s;
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_LEFT));
+    }
+    key_lctl.press();
+    run_one_scan_loop();
+    idle_for(KEY_OVERRIDE_REPEAT_DELAY);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL)).Times(AnyNumber());
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    key_h.release();
+    run_one_scan_loop();
+    key_lctl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, modifier_only_override) {
+    TestDriver driver;
+    auto       key_lctl = KeymapKey(0, 0, 0, KC_LEFT_CTRL);
+    auto       key_lsft = KeymapKey(0, 1, 0, KC_LEFT_SHIFT);
+
+    set_keymap({key_lctl, key_lsft});
+
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    key_lctl.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_F13));
+    }
+    key_lsft.press();
+    run_one_scan_loop();
+    idle_for(KEY_OVERRIDE_REPEAT_DELAY);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    key_lsft.release();
+    run_one_scan_loop();
+    key_lctl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
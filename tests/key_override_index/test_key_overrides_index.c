@@ -0,0 +1,16 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &ko_make_basic(MOD_MASK_CTRL, KC_H, KC_LEFT),
+    &ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL),
+    &ko_make_basic(MOD_MASK_SHIFT, KC_A, KC_B),
+    &ko_make_basic(MOD_MASK_CTRL, KC_J, KC_DOWN),
+    // Shadowed by the override above, so never activates
+    &ko_make_basic(MOD_MASK_SHIFT, KC_A, KC_C),
+    &ko_make_basic(MOD_MASK_CS, KC_NO, KC_F13),
+};
+// clang-format on
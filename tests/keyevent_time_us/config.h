@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define KEYEVENT_TIME_US
+#define TAPPING_TERM 200
+#define COMBO_TERM 50
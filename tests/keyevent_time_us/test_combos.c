@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum combos { yu_space };
+
+uint16_t const yu_combo[] = {KC_Y, KC_U, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [yu_space] = COMBO(yu_combo, KC_SPACE),
+};
+// clang-format on
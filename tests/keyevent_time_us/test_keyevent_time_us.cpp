@@ -0,0 +1,123 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+void advance_time(uint32_t ms);
+void advance_time_us(uint32_t us);
+}
+
+using testing::_;
+using testing::InSequence;
+
+class KeyeventTimeUs : public TestFixture {};
+
+TEST_F(KeyeventTimeUs, TimerKeepsSubMillisecondPart) {
+    advance_time_us(1234);
+    EXPECT_EQ(timer_read32(), 1);
+    EXPECT_EQ(timer_read_us(), 1234);
+
+    advance_time_us(999);
+    EXPECT_EQ(timer_read32(), 2);
+    EXPECT_EQ(timer_read_us(), 2233);
+
+    advance_time(1);
+    EXPECT_EQ(timer_read_us(), 3233);
+}
+
+TEST_F(KeyeventTimeUs, ModTapReleasedJustBeforeTappingTermIsTap) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, LSFT_T(KC_P));
+    set_keymap({mod_tap_key});
+
+    // 199.9ms between press and release, which millisecond timestamps would round up to the full tapping term
+    advance_time_us(500);
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    run_one_scan_loop();
+    advance_time_us(TAPPING_TERM * 1000 - 100 - 1000);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyeventTimeUs, ModTapReleasedAtTappingTermIsHold) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, LSFT_T(KC_P));
+    set_keymap({mod_tap_key});
+
+    advance_time_us(900);
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    run_one_scan_loop();
+    advance_time_us(TAPPING_TERM * 1000 - 1000);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyeventTimeUs, ComboWithinComboTerm) {
+    TestDriver driver;
+    KeymapKey  key_y(0, 0, 1, KC_Y);
+    KeymapKey  key_u(0, 0, 2, KC_U);
+    set_keymap({key_y, key_u});
+
+    advance_time_us(1000);
+    EXPECT_NO_REPORT(driver);
+    key_y.press();
+    run_one_scan_loop();
+    advance_time_us(COMBO_TERM * 1000 - 100 - 1000);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_SPACE));
+    EXPECT_EMPTY_REPORT(driver);
+    key_u.press();
+    run_one_scan_loop();
+    key_y.release();
+    key_u.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyeventTimeUs, ComboPastComboTerm) {
+    TestDriver driver;
+    KeymapKey  key_y(0, 0, 1, KC_Y);
+    KeymapKey  key_u(0, 0, 2, KC_U);
+    set_keymap({key_y, key_u});
+
+    // 50.4ms between the presses, which millisecond timestamps would round down to the combo term
+    advance_time_us(1000);
+    EXPECT_NO_REPORT(driver);
+    key_y.press();
+    run_one_scan_loop();
+    advance_time_us(COMBO_TERM * 1000 + 400 - 1000);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_Y));
+    EXPECT_REPORT(driver, (KC_Y, KC_U));
+    EXPECT_REPORT(driver, (KC_U));
+    EXPECT_EMPTY_REPORT(driver);
+    key_u.press();
+    run_one_scan_loop();
+    key_y.release();
+    run_one_scan_loop();
+    key_u.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
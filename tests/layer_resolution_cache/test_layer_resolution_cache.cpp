@@ -0,0 +1,104 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LayerResolutionCache : public TestFixture {};
+
+TEST_F(LayerResolutionCache, TransparentKeyFallsThrough) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(1, 0, 0, KC_B);
+    KeymapKey  key_trns(2, 0, 0, KC_TRNS);
+    set_keymap({key_a, key_b, key_trns});
+
+    layer_state_set((1 << 1) | (1 << 2));
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 1);
+
+    /* Cached result is returned again */
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 1);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, FollowsLayerStateChanges) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(1, 0, 0, KC_B);
+    set_keymap({key_a, key_b});
+
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 1);
+
+    layer_off(1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    /* Direct assignment without layer_state_set() is picked up too */
+    layer_state = 1 << 1;
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 1);
+    layer_state = 0;
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, FollowsDefaultLayerChanges) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(1, 0, 0, KC_B);
+    set_keymap({key_a, key_b});
+
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    default_layer_set(1 << 1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 1);
+
+    default_layer_set(1 << 0);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, ClearedOnKeymapChange) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_trns(1, 0, 0, KC_TRNS);
+    set_keymap({key_a, key_trns});
+
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    KeymapKey key_b(1, 0, 0, KC_B);
+    set_keymap({key_a, key_b});
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 1);
+
+    layer_off(1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerResolutionCache, KeyPressUsesResolvedLayer) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(1, 0, 0, KC_B);
+    KeymapKey  key_trns(2, 0, 0, KC_TRNS);
+    set_keymap({key_a, key_b, key_trns});
+
+    layer_state_set((1 << 1) | (1 << 2));
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    layer_state_set(1 << 2);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,15 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Room for the RGB Matrix config
+#define EEPROM_SIZE 64
+
+#define RGB_MATRIX_LED_COUNT 8
+#define RGB_MATRIX_DIRTY_TRACKING
+#define RGB_MATRIX_SLEEP
+#define RGB_MATRIX_DEFAULT_MODE RGB_MATRIX_SOLID_COLOR
+#define ENABLE_RGB_MATRIX_GRADIENT_LEFT_RIGHT
@@ -0,0 +1,54 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+// clang-format off
+led_config_t g_led_config = {
+    {
+        { 0, 1, 2, 3, 4, 5, 6, 7, NO_LED, NO_LED },
+        { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+        { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+        { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+    },
+    // Every LED is away from x = 0, so each has its own colour in the left-right gradient
+    { { 28, 0 }, { 56, 0 }, { 84, 0 }, { 112, 0 }, { 140, 0 }, { 168, 0 }, { 196, 0 }, { 224, 0 } },
+    { 4, 4, 4, 4, 4, 4, 4, 4 },
+};
+// clang-format on
+
+// Mock driver, counting the colours written to each LED and the flushes
+uint16_t mock_driver_writes[RGB_MATRIX_LED_COUNT];
+uint16_t mock_driver_flushes;
+
+static void mock_driver_init(void) {}
+
+static void mock_driver_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    mock_driver_writes[index]++;
+}
+
+static void mock_driver_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        mock_driver_set_color(i, red, green, blue);
+    }
+}
+
+static void mock_driver_flush(void) {
+    mock_driver_flushes++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = mock_driver_init,
+    .flush         = mock_driver_flush,
+    .set_color     = mock_driver_set_color,
+    .set_color_all = mock_driver_set_color_all,
+};
+
+// LED lit white by the indicators, or -1 for none
+int indicator_led = -1;
+
+bool rgb_matrix_indicators_user(void) {
+    if (indicator_led >= 0) {
+        rgb_matrix_set_color(indicator_led, RGB_WHITE);
+    }
+    return true;
+}
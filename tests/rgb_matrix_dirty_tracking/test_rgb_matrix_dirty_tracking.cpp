@@ -0,0 +1,126 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "test_common.hpp"
+
+using testing::_;
+
+extern "C" {
+extern uint16_t mock_driver_writes[RGB_MATRIX_LED_COUNT];
+extern uint16_t mock_driver_flushes;
+extern int      indicator_led;
+}
+
+// Long enough for several frames to be rendered and flushed
+#define FRAMES_TIME 200
+
+class RgbMatrixDirtyTracking : public TestFixture {
+   public:
+    void SetUp() override {
+        TestDriver driver;
+        EXPECT_NO_REPORT(driver);
+
+        indicator_led = -1;
+        rgb_matrix_set_suspend_state(false);
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+        rgb_matrix_sethsv_noeeprom(HSV_RED);
+        idle_for(FRAMES_TIME);
+        clear_driver();
+        VERIFY_AND_CLEAR(driver);
+    }
+
+    void clear_driver() {
+        memset(mock_driver_writes, 0, sizeof(mock_driver_writes));
+        mock_driver_flushes = 0;
+    }
+
+    void expect_full_redraw() {
+        for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            EXPECT_GT(mock_driver_writes[i], 0) << "LED " << i;
+        }
+        EXPECT_GT(mock_driver_flushes, 0);
+    }
+};
+
+TEST_F(RgbMatrixDirtyTracking, unchanged_frames_are_not_flushed) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    idle_for(FRAMES_TIME);
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        EXPECT_EQ(mock_driver_writes[i], 0) << "LED " << i;
+    }
+    EXPECT_EQ(mock_driver_flushes, 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixDirtyTracking, single_led_change_only_writes_that_led) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    indicator_led = 3;
+    idle_for(FRAMES_TIME);
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        EXPECT_EQ(mock_driver_writes[i], i == 3 ? 1 : 0) << "LED " << i;
+    }
+    EXPECT_EQ(mock_driver_flushes, 1);
+
+    // The effect restores the LED once the indicator turns off
+    clear_driver();
+    indicator_led = -1;
+    idle_for(FRAMES_TIME);
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        EXPECT_EQ(mock_driver_writes[i], i == 3 ? 1 : 0) << "LED " << i;
+    }
+    EXPECT_EQ(mock_driver_flushes, 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixDirtyTracking, external_write_is_overwritten_by_effect) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    rgb_matrix_set_color(5, RGB_BLUE);
+    idle_for(FRAMES_TIME);
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        EXPECT_EQ(mock_driver_writes[i], i == 5 ? 2 : 0) << "LED " << i;
+    }
+    EXPECT_EQ(mock_driver_flushes, 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixDirtyTracking, mode_change_redraws_all_leds) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_GRADIENT_LEFT_RIGHT);
+    idle_for(FRAMES_TIME);
+    expect_full_redraw();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixDirtyTracking, brightness_change_redraws_all_leds) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    rgb_matrix_decrease_val_noeeprom();
+    idle_for(FRAMES_TIME);
+    expect_full_redraw();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixDirtyTracking, suspend_and_resume_redraw_all_leds) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    rgb_matrix_set_suspend_state(true);
+    idle_for(FRAMES_TIME);
+    expect_full_redraw();
+
+    clear_driver();
+    rgb_matrix_set_suspend_state(false);
+    idle_for(FRAMES_TIME);
+    expect_full_redraw();
+    VERIFY_AND_CLEAR(driver);
+}
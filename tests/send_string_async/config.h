@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define SEND_STRING_ASYNC_ENABLE
+#define SEND_STRING_ASYNC_QUEUE_SIZE 16
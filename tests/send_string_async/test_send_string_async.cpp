@@ -0,0 +1,170 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+static int completions;
+
+static void count_completion(void *context) {
+    completions++;
+    EXPECT_EQ(context, &completions);
+}
+
+class SendStringAsync : public TestFixture {
+   public:
+    void SetUp() override {
+        completions = 0;
+    }
+};
+
+TEST_F(SendStringAsync, types_from_the_main_loop) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    EXPECT_TRUE(send_string_async("ab", 0, count_completion, &completions));
+    EXPECT_TRUE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    // One report per scan loop
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    EXPECT_EQ(completions, 0);
+    run_one_scan_loop();
+    run_one_scan_loop();
+    EXPECT_EQ(completions, 1);
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, delay_does_not_block) {
+    TestDriver driver;
+    auto       key_c = KeymapKey(0, 0, 0, KC_C);
+
+    set_keymap({key_c});
+
+    EXPECT_TRUE(send_string_async("a" SS_DELAY(50) "b", 0, NULL, NULL));
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    // The keyboard keeps working while the macro waits
+    EXPECT_REPORT(driver, (KC_C));
+    key_c.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_c.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(35);
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    idle_for(10);
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, streams_strings_longer_than_the_queue) {
+    TestDriver driver;
+
+    {
+        InSequence s;
+        for (int i = 0; i < 10; i++) {
+            EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+            EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_X));
+            EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+            EXPECT_EMPTY_REPORT(driver);
+            EXPECT_REPORT(driver, (KC_Y));
+            EXPECT_EMPTY_REPORT(driver);
+        }
+    }
+    EXPECT_TRUE(send_string_async("XyXyXyXyXyXyXyXyXyXy", 0, count_completion, &completions));
+
+    // Backpressure: the rest of the string has not been queued yet
+    EXPECT_FALSE(send_string_async("z", 0, NULL, NULL));
+    send_string_async_begin();
+    send_string("z");
+    EXPECT_FALSE(send_string_async_end(NULL, NULL));
+
+    idle_for(200);
+    EXPECT_EQ(completions, 1);
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, batch_is_all_or_nothing) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    send_string_async_begin();
+    send_string("abcdefghij");
+    EXPECT_FALSE(send_string_async_end(count_completion, &completions));
+    EXPECT_FALSE(send_string_async_busy());
+    idle_for(50);
+    EXPECT_EQ(completions, 0);
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+        EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_A));
+        EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    send_string_async_begin();
+    send_string(SS_LCTL("a"));
+    EXPECT_TRUE(send_string_async_end(count_completion, &completions));
+    idle_for(50);
+    EXPECT_EQ(completions, 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, weak_mods_are_cleared_in_order) {
+    TestDriver driver;
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+        EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    send_string_async_begin();
+    send_string_tap_code(KC_A);
+    send_string_clear_weak_mods();
+    send_string_tap_code(KC_B);
+    EXPECT_TRUE(send_string_async_end(NULL, NULL));
+    // Still applies to the keys queued before the weak mods are cleared
+    add_weak_mods(MOD_BIT(KC_LEFT_SHIFT));
+    idle_for(50);
+    EXPECT_EQ(get_weak_mods(), 0);
+    VERIFY_AND_CLEAR(driver);
+}
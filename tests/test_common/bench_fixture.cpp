@@ -0,0 +1,265 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bench_fixture.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "keycode.h"
+#include "test_driver.hpp"
+
+extern "C" {
+#include "keyboard.h"
+#include "test_matrix.h"
+
+void advance_time(uint32_t ms);
+
+/* The benchmark executables are linked with --wrap for these, so every call made by the firmware lands here. */
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+}
+
+static bool   counting_allocations = false;
+static size_t allocation_count     = 0;
+static size_t allocated_bytes      = 0;
+
+static void count_allocation(size_t size) {
+    if (counting_allocations) {
+        allocation_count++;
+        allocated_bytes += size;
+    }
+}
+
+extern "C" void* __wrap_malloc(size_t size) {
+    count_allocation(size);
+    return __real_malloc(size);
+}
+
+extern "C" void* __wrap_calloc(size_t count, size_t size) {
+    count_allocation(count * size);
+    return __real_calloc(count, size);
+}
+
+extern "C" void* __wrap_realloc(void* ptr, size_t size) {
+    count_allocation(size);
+    return __real_realloc(ptr, size);
+}
+
+BenchTrace& BenchTrace::press(const KeymapKey& key, uint16_t delay_ms) {
+    events.push_back({static_cast<uint16_t>(trailing_delay_ms + delay_ms), key.position.col, key.position.row, true});
+    trailing_delay_ms = 0;
+    return *this;
+}
+
+BenchTrace& BenchTrace::release(const KeymapKey& key, uint16_t delay_ms) {
+    events.push_back({static_cast<uint16_t>(trailing_delay_ms + delay_ms), key.position.col, key.position.row, false});
+    trailing_delay_ms = 0;
+    return *this;
+}
+
+BenchTrace& BenchTrace::tap(const KeymapKey& key, uint16_t hold_ms, uint16_t gap_ms) {
+    return press(key, gap_ms).release(key, hold_ms);
+}
+
+BenchTrace& BenchTrace::chord(std::initializer_list<KeymapKey> keys, uint16_t hold_ms, uint16_t gap_ms) {
+    uint16_t delay_ms = gap_ms;
+    for (const KeymapKey& key : keys) {
+        press(key, delay_ms);
+        delay_ms = 5;
+    }
+    delay_ms = hold_ms;
+    for (const KeymapKey& key : keys) {
+        release(key, delay_ms);
+        delay_ms = 5;
+    }
+    return *this;
+}
+
+BenchTrace& BenchTrace::append(const BenchTrace& other) {
+    for (BenchEvent event : other.events) {
+        event.delay_ms += trailing_delay_ms;
+        trailing_delay_ms = 0;
+        events.push_back(event);
+    }
+    trailing_delay_ms += other.trailing_delay_ms;
+    return *this;
+}
+
+BenchTrace& BenchTrace::idle(uint16_t ms) {
+    trailing_delay_ms += ms;
+    return *this;
+}
+
+BenchTrace BenchTrace::parse(const std::string& log) {
+    BenchTrace         trace;
+    std::istringstream lines(log);
+    std::string        line;
+    bool               first = true;
+    unsigned           last_time = 0;
+
+    while (std::getline(lines, line)) {
+        const char* col_field = std::strstr(line.c_str(), "col:");
+        unsigned    col, row, pressed, time;
+        if (col_field == nullptr || std::sscanf(col_field, "col: %u, row: %u, pressed: %u, time: %u", &col, &row, &pressed, &time) != 4) {
+            continue;
+        }
+
+        uint16_t delay_ms = first ? 0 : static_cast<uint16_t>(time - last_time);
+        trace.events.push_back({static_cast<uint16_t>(trace.trailing_delay_ms + delay_ms), static_cast<uint8_t>(col), static_cast<uint8_t>(row), pressed != 0});
+        trace.trailing_delay_ms = 0;
+        last_time               = time;
+        first                   = false;
+    }
+    return trace;
+}
+
+void BenchFixture::set_qwerty_keymap(std::initializer_list<KeymapKey> overrides) {
+    // clang-format off
+    static const uint16_t qwerty[MATRIX_ROWS][MATRIX_COLS] = {
+        {KC_Q, KC_W, KC_E, KC_R, KC_T, KC_Y,     KC_U,    KC_I,     KC_O,    KC_P},
+        {KC_A, KC_S, KC_D, KC_F, KC_G, KC_H,     KC_J,    KC_K,     KC_L,    KC_SCLN},
+        {KC_Z, KC_X, KC_C, KC_V, KC_B, KC_N,     KC_M,    KC_COMM,  KC_DOT,  KC_SLSH},
+        {KC_1, KC_2, KC_3, KC_4, KC_5, KC_SPACE, KC_LSFT, KC_ENTER, KC_BSPC, KC_TAB},
+    };
+    // clang-format on
+
+    set_keymap({});
+    for (const KeymapKey& key : overrides) {
+        add_key(key);
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (find_key(0, {.col = col, .row = row}) == nullptr) {
+                add_key(KeymapKey(0, col, row, qwerty[row][col]));
+            }
+        }
+    }
+}
+
+const KeymapKey& BenchFixture::key_for(uint16_t keycode) const {
+    for (const KeymapKey& key : keymap) {
+        if (key.layer == 0 && key.code == keycode) {
+            return key;
+        }
+    }
+    ADD_FAILURE() << "no key is mapped to " << get_keycode_identifier_or_default(keycode) << " on layer 0";
+    return keymap.front();
+}
+
+BenchTrace BenchFixture::typing(const std::string& text, uint16_t hold_ms, uint16_t gap_ms) const {
+    BenchTrace trace;
+
+    for (char c : text) {
+        uint16_t keycode = KC_NO;
+        bool     shifted = false;
+
+        if (c >= 'a' && c <= 'z') {
+            keycode = KC_A + (c - 'a');
+        } else if (c >= 'A' && c <= 'Z') {
+            keycode = KC_A + (c - 'A');
+            shifted = true;
+        } else if (c >= '1' && c <= '9') {
+            keycode = KC_1 + (c - '1');
+        } else {
+            switch (c) {
+                case '0':
+                    keycode = KC_0;
+                    break;
+                case ' ':
+                    keycode = KC_SPACE;
+                    break;
+                case '\n':
+                    keycode = KC_ENTER;
+                    break;
+                case ',':
+                    keycode = KC_COMM;
+                    break;
+                case '.':
+                    keycode = KC_DOT;
+                    break;
+                case ';':
+                    keycode = KC_SCLN;
+                    break;
+                case '/':
+                    keycode = KC_SLSH;
+                    break;
+                default:
+                    ADD_FAILURE() << "cannot type '" << c << "'";
+                    continue;
+            }
+        }
+
+        if (shifted) {
+            const KeymapKey& shift = key_for(KC_LSFT);
+            trace.press(shift, gap_ms).tap(key_for(keycode), hold_ms, hold_ms / 2).release(shift, hold_ms / 2);
+        } else {
+            trace.tap(key_for(keycode), hold_ms, gap_ms);
+        }
+    }
+    return trace;
+}
+
+void BenchFixture::scan(unsigned ms) {
+    for (unsigned i = 0; i < ms; i++) {
+        keyboard_task();
+        housekeeping_task();
+        advance_time(1);
+    }
+}
+
+BenchResult BenchFixture::replay(const BenchTrace& trace, unsigned iterations) {
+    testing::NiceMock<TestDriver> driver;
+    BenchResult                   result = {};
+
+    auto run_trace = [&]() {
+        for (const BenchEvent& event : trace.events) {
+            scan(event.delay_ms);
+            if (event.pressed) {
+                press_key(event.col, event.row);
+            } else {
+                release_key(event.col, event.row);
+            }
+            scan(1);
+            result.scans += event.delay_ms + 1;
+        }
+        scan(trace.trailing_delay_ms);
+        result.scans += trace.trailing_delay_ms;
+    };
+
+    run_trace();
+    result.scans = 0;
+
+    allocation_count     = 0;
+    allocated_bytes      = 0;
+    counting_allocations = true;
+    auto start           = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < iterations; i++) {
+        run_trace();
+    }
+    auto end             = std::chrono::steady_clock::now();
+    counting_allocations = false;
+
+    result.events          = trace.events.size() * iterations;
+    result.elapsed_ns      = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    result.allocations     = allocation_count;
+    result.allocated_bytes = allocated_bytes;
+
+    uint64_t ns_per_event = result.events ? result.elapsed_ns / result.events : 0;
+    uint64_t ns_per_scan  = result.scans ? result.elapsed_ns / result.scans : 0;
+
+    const ::testing::TestInfo* const test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+    std::cout << "[ BENCH    ] " << test_info->test_case_name() << "." << test_info->name() << ": " << result.events << " events, " << result.scans << " scans, " << ns_per_event << " ns/event, " << ns_per_scan << " ns/scan, " << result.allocations << " allocations (" << result.allocated_bytes << " bytes)" << std::endl;
+
+    RecordProperty("events", std::to_string(result.events));
+    RecordProperty("ns_per_event", std::to_string(ns_per_event));
+    RecordProperty("ns_per_scan", std::to_string(ns_per_scan));
+    RecordProperty("allocations", std::to_string(result.allocations));
+    RecordProperty("allocated_bytes", std::to_string(result.allocated_bytes));
+
+    return result;
+}
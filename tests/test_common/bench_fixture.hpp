@@ -0,0 +1,102 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+#ifndef BENCH_ITERATIONS
+#    define BENCH_ITERATIONS 100
+#endif
+
+/**
+ * @brief A single matrix change of a keystroke trace, applied `delay_ms` after the previous one.
+ */
+struct BenchEvent {
+    uint16_t delay_ms;
+    uint8_t  col;
+    uint8_t  row;
+    bool     pressed;
+};
+
+class BenchTrace {
+   public:
+    BenchTrace& press(const KeymapKey& key, uint16_t delay_ms = 0);
+    BenchTrace& release(const KeymapKey& key, uint16_t delay_ms = 0);
+
+    /**
+     * @brief Taps `key`, holding it for `hold_ms` and waiting `gap_ms` before the press.
+     */
+    BenchTrace& tap(const KeymapKey& key, uint16_t hold_ms = 30, uint16_t gap_ms = 60);
+
+    /**
+     * @brief Presses all `keys` a few milliseconds apart, then releases them after `hold_ms`.
+     */
+    BenchTrace& chord(std::initializer_list<KeymapKey> keys, uint16_t hold_ms = 40, uint16_t gap_ms = 60);
+
+    /**
+     * @brief Appends the events of `other` to this trace.
+     */
+    BenchTrace& append(const BenchTrace& other);
+
+    /**
+     * @brief Waits `ms` before the next event, e.g. to let a timeout expire.
+     */
+    BenchTrace& idle(uint16_t ms);
+
+    /**
+     * @brief Parses a trace recorded with the `KL:` key logging example from the debugging FAQ.
+     *
+     * Each line must contain `col: <n>, row: <n>, pressed: <0|1>, time: <ms>`; other lines are ignored.
+     */
+    static BenchTrace parse(const std::string& log);
+
+    std::vector<BenchEvent> events;
+    // Time to wait after the last event, or before the next appended one
+    uint16_t trailing_delay_ms = 0;
+};
+
+struct BenchResult {
+    size_t   events;
+    size_t   scans;
+    uint64_t elapsed_ns;
+    size_t   allocations;
+    size_t   allocated_bytes;
+};
+
+/**
+ * @brief Replays keystroke traces through the full keyboard_task() pipeline and reports their cost.
+ *
+ * Every millisecond of the trace runs one scan loop, like TestFixture::idle_for(), so the reported
+ * time per event includes the scans spent waiting for tapping terms and timeouts. Allocations count
+ * the malloc(), calloc() and realloc() calls made by the firmware while the trace is replayed.
+ */
+class BenchFixture : public TestFixture {
+   public:
+    /**
+     * @brief Maps a QWERTY layout on layer 0, with `overrides` replacing the keys at their positions.
+     *
+     * Row 3 holds `1`-`5`, space, left shift, enter, backspace and tab.
+     */
+    void set_qwerty_keymap(std::initializer_list<KeymapKey> overrides = {});
+
+    /**
+     * @brief Builds a trace that types `text` on layer 0, holding left shift for upper case letters.
+     */
+    BenchTrace typing(const std::string& text, uint16_t hold_ms = 30, uint16_t gap_ms = 60) const;
+
+    /**
+     * @brief Replays `trace` once to warm up, then `iterations` times while measuring, and prints the result.
+     */
+    BenchResult replay(const BenchTrace& trace, unsigned iterations = BENCH_ITERATIONS);
+
+   private:
+    const KeymapKey& key_for(uint16_t keycode) const;
+    void             scan(unsigned ms);
+};
@@ -31,6 +31,7 @@
 #include "usb_descriptor.h"
 #include "usb_driver.h"
 #include "usb_types.h"
+#include "ring_buffer.h"
 
 #ifdef NKRO_ENABLE
 #    include "keycode_config.h"
@@ -94,35 +95,13 @@ static const USBDescriptor *usb_get_descriptor_cb(USBDriver *usbp, uint8_t dtype
  * ---------------------------------------------------------
  */
 
-#define USB_EVENT_QUEUE_SIZE 16
-usbevent_t event_queue[USB_EVENT_QUEUE_SIZE];
-uint8_t    event_queue_head;
-uint8_t    event_queue_tail;
+// Filled by the USB interrupt, and drained by usb_event_queue_task()
+RING_BUFFER_DEFINE(usb_event_queue, usbevent_t, 16)
+static usb_event_queue_t event_queue;
 
 void usb_event_queue_init(void) {
     // Initialise the event queue
     memset(&event_queue, 0, sizeof(event_queue));
-    event_queue_head = 0;
-    event_queue_tail = 0;
-}
-
-static inline bool usb_event_queue_enqueue(usbevent_t event) {
-    uint8_t next = (event_queue_head + 1) % USB_EVENT_QUEUE_SIZE;
-    if (next == event_queue_tail) {
-        return false;
-    }
-    event_queue[event_queue_head] = event;
-    event_queue_head              = next;
-    return true;
-}
-
-static inline bool usb_event_queue_dequeue(usbevent_t *event) {
-    if (event_queue_head == event_queue_tail) {
-        return false;
-    }
-    *event           = event_queue[event_queue_tail];
-    event_queue_tail = (event_queue_tail + 1) % USB_EVENT_QUEUE_SIZE;
-    return true;
 }
 
 static inline void usb_event_suspend_handler(void) {
@@ -146,7 +125,7 @@ bool last_suspend_state = false;
 
 void usb_event_queue_task(void) {
     usbevent_t event;
-    while (usb_event_queue_dequeue(&event)) {
+    while (usb_event_queue_pop(&event_queue, &event)) {
         switch (event) {
             case USB_EVENT_SUSPEND:
                 last_suspend_state = true;
@@ -189,16 +168,16 @@ static void usb_event_cb(USBDriver *usbp, usbevent_t event) {
             }
             osalSysUnlockFromISR();
             if (last_suspend_state) {
-                usb_event_queue_enqueue(USB_EVENT_WAKEUP);
+                usb_event_queue_push(&event_queue, USB_EVENT_WAKEUP);
             }
-            usb_event_queue_enqueue(USB_EVENT_CONFIGURED);
+            usb_event_queue_push(&event_queue, USB_EVENT_CONFIGURED);
             return;
         case USB_EVENT_SUSPEND:
             /* Falls into.*/
         case USB_EVENT_UNCONFIGURED:
             /* Falls into.*/
         case USB_EVENT_RESET:
-            usb_event_queue_enqueue(event);
+            usb_event_queue_push(&event_queue, event);
             chSysLockFromISR();
             for (int i = 0; i < USB_ENDPOINT_IN_COUNT; i++) {
                 usb_endpoint_in_suspend_cb(&usb_endpoints_in[i]);
@@ -218,7 +197,7 @@ static void usb_event_cb(USBDriver *usbp, usbevent_t event) {
                 usb_endpoint_out_wakeup_cb(&usb_endpoints_out[i]);
             }
             chSysUnlockFromISR();
-            usb_event_queue_enqueue(USB_EVENT_WAKEUP);
+            usb_event_queue_push(&event_queue, USB_EVENT_WAKEUP);
             return;
 
         case USB_EVENT_STALLED:
@@ -23,24 +23,27 @@
 #include "util.h"
 #include <string.h>
 
+// All of the keys currently pressed, which the 6KRO and NKRO reports are derived from
+static uint8_t  key_bits[32];
+static uint8_t  key_count      = 0;
+static uint8_t  unslotted_keys = 0; // keys pressed while all of the 6KRO slots were taken
+static uint16_t key_generation = 0;
+
+_Static_assert(sizeof(key_bits) * 8 > 0xFF, "Key bitmap must hold every keycode");
+#ifdef NKRO_ENABLE
+_Static_assert(NKRO_REPORT_BITS <= sizeof(key_bits), "NKRO report larger than the key bitmap");
+#endif
+
+static inline bool key_bit(uint8_t code) {
+    return key_bits[code >> 3] & (1 << (code & 7));
+}
+
 /** \brief has_anykey
  *
- * FIXME: Needs doc
+ * Returns the number of keys pressed, excluding modifiers.
  */
 uint8_t has_anykey(void) {
-    uint8_t  cnt = 0;
-    uint8_t* p   = keyboard_report->keys;
-    uint8_t  lp  = sizeof(keyboard_report->keys);
-#ifdef NKRO_ENABLE
-    if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        p  = nkro_report->bits;
-        lp = sizeof(nkro_report->bits);
-    }
-#endif
-    while (lp--) {
-        if (*p++) cnt++;
-    }
-    return cnt;
+    return key_count;
 }
 
 /** \brief get_first_key
@@ -51,9 +54,9 @@ uint8_t get_first_key(void) {
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
         uint8_t i = 0;
-        for (; i < NKRO_REPORT_BITS && !nkro_report->bits[i]; i++)
+        for (; i < NKRO_REPORT_BITS && !key_bits[i]; i++)
             ;
-        return i << 3 | biton(nkro_report->bits[i]);
+        return i < NKRO_REPORT_BITS ? i << 3 | biton(key_bits[i]) : KC_NO;
     }
 #endif
     return keyboard_report->keys[0];
@@ -61,28 +64,23 @@ uint8_t get_first_key(void) {
 
 /** \brief Checks if a key is pressed in the report
  *
- * Returns true if the keyboard_report reports that the key is pressed, otherwise false
+ * Returns true if the key is pressed, otherwise false
  * Note: The function doesn't support modifers currently, and it returns false for KC_NO
  */
 bool is_key_pressed(uint8_t key) {
     if (key == KC_NO) {
         return false;
     }
-#ifdef NKRO_ENABLE
-    if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        if ((key >> 3) < NKRO_REPORT_BITS) {
-            return nkro_report->bits[key >> 3] & 1 << (key & 7);
-        } else {
-            return false;
-        }
-    }
-#endif
-    for (int i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
-        if (keyboard_report->keys[i] == key) {
-            return true;
-        }
-    }
-    return false;
+    return key_bit(key);
+}
+
+/** \brief Gets the generation of the pressed keys
+ *
+ * Incremented every time a key is added to or removed from the report, so that senders can skip comparing unchanged reports.
+ * add/del_key_byte and add/del_key_bit also increment it, as they can be pointed at the live report.
+ */
+uint16_t get_report_keys_generation(void) {
+    return key_generation;
 }
 
 /** \brief add key byte
@@ -103,6 +101,7 @@ void add_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
     if (i == KEYBOARD_REPORT_KEYS) {
         if (empty != -1) {
             keyboard_report->keys[empty] = code;
+            key_generation++;
         }
     }
 }
@@ -115,6 +114,7 @@ void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
     for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
         if (keyboard_report->keys[i] == code) {
             keyboard_report->keys[i] = 0;
+            key_generation++;
         }
     }
 }
@@ -127,6 +127,7 @@ void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
 void add_key_bit(report_nkro_t* nkro_report, uint8_t code) {
     if ((code >> 3) < NKRO_REPORT_BITS) {
         nkro_report->bits[code >> 3] |= 1 << (code & 7);
+        key_generation++;
     } else {
         dprintf("add_key_bit: can't add: %02X\n", code);
     }
@@ -139,38 +140,87 @@ void add_key_bit(report_nkro_t* nkro_report, uint8_t code) {
 void del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
     if ((code >> 3) < NKRO_REPORT_BITS) {
         nkro_report->bits[code >> 3] &= ~(1 << (code & 7));
+        key_generation++;
     } else {
         dprintf("del_key_bit: can't del: %02X\n", code);
     }
 }
 #endif
 
+// Puts a key in the first free 6KRO slot, so that keys already in the report keep their position
+static bool slot_key(uint8_t code) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (keyboard_report->keys[i] == 0) {
+            keyboard_report->keys[i] = code;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Frees the 6KRO slot of a key, returning false if it didn't have one
+static bool unslot_key(uint8_t code) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (keyboard_report->keys[i] == code) {
+            keyboard_report->keys[i] = 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool has_slot(uint8_t code) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (keyboard_report->keys[i] == code) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Gives a freed 6KRO slot to the lowest pressed key that is missing from the report
+static void backfill_slot(void) {
+    for (uint16_t code = 1; code <= 0xFF; code++) {
+        if (key_bit(code) && !has_slot(code)) {
+            slot_key(code);
+            unslotted_keys--;
+            return;
+        }
+    }
+}
+
 /** \brief add key to report
  *
- * FIXME: Needs doc
+ * Sets the key in the bitmap, and gives it a 6KRO slot if one is free.
  */
 void add_key_to_report(uint8_t key) {
-#ifdef NKRO_ENABLE
-    if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        add_key_bit(nkro_report, key);
+    if (key == KC_NO || key_bit(key)) {
         return;
     }
-#endif
-    add_key_byte(keyboard_report, key);
+    key_bits[key >> 3] |= 1 << (key & 7);
+    key_count++;
+    key_generation++;
+    if (!slot_key(key)) {
+        unslotted_keys++;
+    }
 }
 
 /** \brief del key from report
  *
- * FIXME: Needs doc
+ * Clears the key from the bitmap, and hands its 6KRO slot to a key that didn't fit.
  */
 void del_key_from_report(uint8_t key) {
-#ifdef NKRO_ENABLE
-    if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        del_key_bit(nkro_report, key);
+    if (key == KC_NO || !key_bit(key)) {
         return;
     }
-#endif
-    del_key_byte(keyboard_report, key);
+    key_bits[key >> 3] &= ~(1 << (key & 7));
+    key_count--;
+    key_generation++;
+    if (!unslot_key(key)) {
+        unslotted_keys--;
+    } else if (unslotted_keys) {
+        backfill_slot();
+    }
 }
 
 /** \brief clear key from report
@@ -179,15 +229,23 @@ void del_key_from_report(uint8_t key) {
  */
 void clear_keys_from_report(void) {
     // not clear mods
-#ifdef NKRO_ENABLE
-    if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        memset(nkro_report->bits, 0, sizeof(nkro_report->bits));
-        return;
-    }
-#endif
+    memset(key_bits, 0, sizeof(key_bits));
     memset(keyboard_report->keys, 0, sizeof(keyboard_report->keys));
+    key_count      = 0;
+    unslotted_keys = 0;
+    key_generation++;
 }
 
+#ifdef NKRO_ENABLE
+/** \brief Copies the pressed keys into an NKRO report
+ *
+ * Keys beyond the end of the NKRO report are left out.
+ */
+void keys_to_nkro_report(report_nkro_t* nkro_report) {
+    memcpy(nkro_report->bits, key_bits, sizeof(nkro_report->bits));
+}
+#endif
+
 #ifdef MOUSE_ENABLE
 /**
  * @brief Compares 2 mouse reports for difference and returns result. Empty
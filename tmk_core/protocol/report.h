@@ -332,9 +332,10 @@ static inline uint16_t KEYCODE2CONSUMER(uint8_t key) {
     }
 }
 
-uint8_t has_anykey(void);
-uint8_t get_first_key(void);
-bool    is_key_pressed(uint8_t key);
+uint8_t  has_anykey(void);
+uint8_t  get_first_key(void);
+bool     is_key_pressed(uint8_t key);
+uint16_t get_report_keys_generation(void);
 
 void add_key_byte(report_keyboard_t* keyboard_report, uint8_t code);
 void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code);
@@ -346,6 +347,9 @@ void del_key_bit(report_nkro_t* nkro_report, uint8_t code);
 void add_key_to_report(uint8_t key);
 void del_key_from_report(uint8_t key);
 void clear_keys_from_report(void);
+#ifdef NKRO_ENABLE
+void keys_to_nkro_report(report_nkro_t* nkro_report);
+#endif
 
 #ifdef MOUSE_ENABLE
 bool has_mouse_report_changed(report_mouse_t* new_report, report_mouse_t* old_report);
@@ -41,7 +41,6 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #endif
 
 #if defined(CONSOLE_ENABLE)
-#    define RBUF_SIZE 128
 #    include "ring_buffer.h"
 #endif
 
@@ -179,8 +178,11 @@ void raw_hid_task(void) {
 #    define CONSOLE_BUFFER_SIZE 32
 #    define CONSOLE_EPSIZE 8
 
+RING_BUFFER_DEFINE(console_queue, uint8_t, 128)
+static console_queue_t console_queue;
+
 int8_t sendchar(uint8_t c) {
-    rbuf_enqueue(c);
+    console_queue_push(&console_queue, c);
     return 0;
 }
 
@@ -191,16 +193,13 @@ void console_task(void) {
         return;
     }
 
-    if (!rbuf_has_data()) {
+    if (console_queue_is_empty(&console_queue)) {
         return;
     }
 
     // Send in chunks of 8 padded to 32
-    char    send_buf[CONSOLE_BUFFER_SIZE] = {0};
-    uint8_t send_buf_count                = 0;
-    while (rbuf_has_data() && send_buf_count < CONSOLE_EPSIZE) {
-        send_buf[send_buf_count++] = rbuf_dequeue();
-    }
+    uint8_t send_buf[CONSOLE_BUFFER_SIZE] = {0};
+    console_queue_pop_many(&console_queue, send_buf, CONSOLE_EPSIZE);
 
     send_report(3, send_buf, CONSOLE_BUFFER_SIZE);
 }